@@ -12,6 +12,10 @@ complete -c history -n '__fish_seen_subcommand_from search delete' \
     -s t -l show-time -d "Output with timestamps"
 complete -c history -n '__fish_seen_subcommand_from search' \
     -s n -l max -d "Limit output to the first 'n' matches"
+complete -x -c history -n '__fish_seen_subcommand_from search delete' \
+    -l since -d "Only match items from this time or later"
+complete -x -c history -n '__fish_seen_subcommand_from search delete' \
+    -l until -d "Only match items from this time or earlier"
 
 # We don't include a completion for the "save" subcommand because it should not be used
 # interactively.
@@ -18,6 +18,7 @@ end
 function __fish_unexpected_hist_args --no-scope-shadowing
     if test -n "$search_mode"
         or test -n "$show_time"
+        or set -q time_range[1]
         printf (_ "%ls: you cannot use any options with the %ls command\n") $cmd $hist_cmd >&2
         return 0
     end
@@ -37,6 +38,7 @@ function history --description "display or manipulate interactive command histor
     set -l max_count
     set -l case_sensitive
     set -l null
+    set -l time_range
 
     # Check for a recognized subcommand as the first argument.
     if set -q argv[1]
@@ -93,6 +95,11 @@ function history --description "display or manipulate interactive command histor
                     set max_count $argv[1] $argv[2]
                     set -e argv[1]
                 end
+            case '--since=*' '--until=*'
+                set time_range $time_range $argv[1]
+            case --since --until
+                set time_range $time_range $argv[1] $argv[2]
+                set -e argv[1]
             case --
                 set -e argv[1]
                 break
@@ -131,9 +138,9 @@ function history --description "display or manipulate interactive command histor
                 set -l pager less
                 set -q PAGER
                 and set pager $PAGER
-                builtin history search $search_mode $show_time $max_count $case_sensitive $null -- $argv | eval $pager
+                builtin history search $search_mode $show_time $max_count $time_range $case_sensitive $null -- $argv | eval $pager
             else
-                builtin history search $search_mode $show_time $max_count $case_sensitive $null -- $argv
+                builtin history search $search_mode $show_time $max_count $time_range $case_sensitive $null -- $argv
             end
 
         case delete # interactively delete history
@@ -147,14 +154,14 @@ function history --description "display or manipulate interactive command histor
             and set search_mode "--contains"
 
             if test $search_mode = "--exact"
-                builtin history delete $search_mode $case_sensitive $argv
+                builtin history delete $search_mode $time_range $case_sensitive $argv
                 return
             end
 
             # TODO: Fix this so that requesting history entries with a timestamp works:
             #   set -l found_items (builtin history search $search_mode $show_time -- $argv)
             set -l found_items
-            builtin history search $search_mode $case_sensitive --null -- $argv | while read -lz x
+            builtin history search $search_mode $time_range $case_sensitive --null -- $argv | while read -lz x
                 set found_items $found_items $x
             end
             if set -q found_items[1]
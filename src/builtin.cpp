@@ -27,9 +27,11 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 #include <wchar.h>
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <memory>
 #include <random>
@@ -40,6 +42,7 @@
 #include "builtin_commandline.h"
 #include "builtin_complete.h"
 #include "builtin_jobs.h"
+#include "builtin_math.h"
 #include "builtin_printf.h"
 #include "builtin_set.h"
 #include "builtin_set_color.h"
@@ -1992,54 +1995,24 @@ static int read_interactive(wcstring &buff, int nchars, bool shell, const wchar_
     return exit_res;
 }
 
-/// Bash uses 128 bytes for its chunk size. Very informal testing I did suggested that a smaller
-/// chunk size performed better. However, we're going to use the bash value under the assumption
-/// they've done more extensive testing.
-#define READ_CHUNK_SIZE 128
-
-/// Read from the fd in chunks until we see newline or null, as appropriate, is seen. This is only
-/// used when the fd is seekable (so not from a tty or pipe) and we're not reading a specific number
-/// of chars.
+/// Read from the stream until we see newline or null, as appropriate. This is only used when the
+/// fd is seekable (so not from a tty or pipe) and we're not reading a specific number of chars.
 /// Returns an exit status
-static int read_in_chunks(int fd, wcstring &buff, bool split_null) {
-    int exit_res = STATUS_BUILTIN_OK;
+static int read_in_chunks(input_stream_t &in, wcstring &buff, bool split_null) {
     std::string str;
-    bool eof = false;
-    bool finished = false;
-
-    while (!finished) {
-        char inbuf[READ_CHUNK_SIZE];
-        long bytes_read = read_blocked(fd, inbuf, READ_CHUNK_SIZE);
-
-        if (bytes_read <= 0) {
-            eof = true;
-            break;
-        }
-
-        const char *end = std::find(inbuf, inbuf + bytes_read, split_null ? L'\0' : L'\n');
-        long bytes_consumed = end - inbuf;  // note: must be signed for use in lseek
-        assert(bytes_consumed <= bytes_read);
-        str.append(inbuf, bytes_consumed);
-        if (bytes_consumed < bytes_read) {
-            // We found a splitter
-            // +1 because we need to treat the splitter as consumed, but not append it to the string
-            CHECK(lseek(fd, bytes_consumed - bytes_read + 1, SEEK_CUR) != -1, STATUS_BUILTIN_ERROR)
-            finished = true;
-        }
-    }
-
+    bool read_anything = in.read_until(split_null ? '\0' : '\n', &str);
     buff = str2wcstring(str);
-    if (buff.empty() && eof) {
-        exit_res = STATUS_BUILTIN_ERROR;
+    if (buff.empty() && !read_anything) {
+        return STATUS_BUILTIN_ERROR;
     }
-
-    return exit_res;
+    return STATUS_BUILTIN_OK;
 }
 
-/// Read from the fd on char at a time until we've read the requested number of characters or a
-/// newline or null, as appropriate, is seen. This is inefficient so should only be used when the
-/// fd is not seekable.
-static int read_one_char_at_a_time(int fd, wcstring &buff, int nchars, bool split_null) {
+/// Read from the stream one char at a time until we've read the requested number of characters or a
+/// newline or null, as appropriate, is seen. The stream reads the underlying fd in chunks where that
+/// is safe.
+static int read_one_char_at_a_time(input_stream_t &in, wcstring &buff, int nchars,
+                                   bool split_null) {
     int exit_res = STATUS_BUILTIN_OK;
     bool eof = false;
 
@@ -2050,7 +2023,7 @@ static int read_one_char_at_a_time(int fd, wcstring &buff, int nchars, bool spli
 
         while (!finished) {
             char b;
-            if (read_blocked(fd, &b, 1) <= 0) {
+            if (!in.read_byte(&b)) {
                 eof = true;
                 break;
             }
@@ -2256,9 +2229,9 @@ static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv)
             read_interactive(buff, nchars, shell, mode_name, prompt, right_prompt, commandline);
         w.woptind = saved_woptind;
     } else if (!nchars && !stream_stdin_is_a_tty && lseek(streams.stdin_fd, 0, SEEK_CUR) != -1) {
-        exit_res = read_in_chunks(streams.stdin_fd, buff, split_null);
+        exit_res = read_in_chunks(streams.stdin_stream(), buff, split_null);
     } else {
-        exit_res = read_one_char_at_a_time(streams.stdin_fd, buff, nchars, split_null);
+        exit_res = read_one_char_at_a_time(streams.stdin_stream(), buff, nchars, split_null);
     }
 
     if (w.woptind == argc || exit_res != STATUS_BUILTIN_OK) {
@@ -2270,18 +2243,12 @@ static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv)
         // Every character is a separate token.
         size_t bufflen = buff.size();
         if (array) {
-            if (bufflen > 0) {
-                wcstring chars(bufflen + (bufflen - 1), ARRAY_SEP);
-                wcstring::iterator out = chars.begin();
-                for (wcstring::const_iterator it = buff.begin(), end = buff.end(); it != end;
-                     ++it) {
-                    *out = *it;
-                    out += 2;
-                }
-                env_set(argv[w.woptind], chars.c_str(), place);
-            } else {
-                env_set(argv[w.woptind], NULL, place);
+            wcstring_list_t chars;
+            chars.reserve(bufflen);
+            for (wcstring::const_iterator it = buff.begin(), end = buff.end(); it != end; ++it) {
+                chars.push_back(wcstring(1, *it));
             }
+            env_set_list(argv[w.woptind], std::move(chars), place);
         } else {  // not array
             size_t j = 0;
             for (; w.woptind + 1 < argc; ++w.woptind) {
@@ -2295,17 +2262,12 @@ static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv)
             if (w.woptind < argc) env_set(argv[w.woptind], &buff[j], place);
         }
     } else if (array) {
-        wcstring tokens;
-        tokens.reserve(buff.size());
-        bool empty = true;
-
+        wcstring_list_t tokens;
         for (wcstring_range loc = wcstring_tok(buff, ifs); loc.first != wcstring::npos;
              loc = wcstring_tok(buff, ifs, loc)) {
-            if (!empty) tokens.push_back(ARRAY_SEP);
-            tokens.append(buff, loc.first, loc.second);
-            empty = false;
+            tokens.push_back(wcstring(buff, loc.first, loc.second));
         }
-        env_set(argv[w.woptind], empty ? NULL : tokens.c_str(), place);
+        env_set_list(argv[w.woptind], std::move(tokens), place);
     } else {  // not array
         wcstring_range loc = wcstring_range(0, 0);
 
@@ -3118,8 +3080,32 @@ static bool set_hist_cmd(wchar_t *const cmd, hist_cmd_t *hist_cmd, hist_cmd_t su
     return true;
 }
 
+/// Parse the argument of --since or --until: either seconds since the epoch, or a number of
+/// seconds, minutes, hours, days or weeks ago, like "90m" or "2d". Returns false if it's neither.
+static bool parse_history_time(const wchar_t *str, time_t *out_time) {
+    const wchar_t *end = NULL;
+    long value = fish_wcstol(str, &end);
+    if (errno == EINVAL || errno == ERANGE || value < 0) return false;
+    if (*end == L'\0') {
+        *out_time = (time_t)value;
+        return true;
+    }
+
+    // Anything after the number must be a single unit suffix.
+    if (end[1] != L'\0') return false;
+    const wchar_t *const suffixes = L"smhdw";
+    const long seconds_per_unit[] = {1, 60, 60 * 60, 24 * 60 * 60, 7 * 24 * 60 * 60};
+    const wchar_t *suffix = wcschr(suffixes, *end);
+    if (suffix == NULL) return false;
+    long seconds = seconds_per_unit[suffix - suffixes];
+    if (value > std::numeric_limits<long>::max() / seconds) return false;
+    *out_time = time(NULL) - (time_t)(value * seconds);
+    return true;
+}
+
 #define CHECK_FOR_UNEXPECTED_HIST_ARGS(hist_cmd)                                                \
-    if (history_search_type_defined || show_time_format || null_terminate) {                    \
+    if (history_search_type_defined || show_time_format || null_terminate ||                    \
+        time_range_defined) {                                                                   \
         const wchar_t *subcmd_str = enum_to_str(hist_cmd, hist_enum_map);                       \
         streams.err.append_format(_(L"%ls: you cannot use any options with the %ls command\n"), \
                                   cmd, subcmd_str);                                             \
@@ -3144,6 +3130,9 @@ static int builtin_history(parser_t &parser, io_streams_t &streams, wchar_t **ar
     const wchar_t *show_time_format = NULL;
     bool case_sensitive = false;
     bool null_terminate = false;
+    bool time_range_defined = false;
+    time_t since = 0;
+    time_t until = std::numeric_limits<time_t>::max();
 
     /// Note: Do not add new flags that represent subcommands. We're encouraging people to switch to
     /// the non-flag subcommand form. While many of these flags are deprecated they must be
@@ -3164,6 +3153,8 @@ static int builtin_history(parser_t &parser, io_streams_t &streams, wchar_t **ar
                                            {L"save", no_argument, NULL, 3},
                                            {L"clear", no_argument, NULL, 4},
                                            {L"merge", no_argument, NULL, 5},
+                                           {L"since", required_argument, NULL, 6},
+                                           {L"until", required_argument, NULL, 7},
                                            {NULL, 0, NULL, 0}};
 
     history_t *history = reader_get_history();
@@ -3205,6 +3196,16 @@ static int builtin_history(parser_t &parser, io_streams_t &streams, wchar_t **ar
                 }
                 break;
             }
+            case 6:
+            case 7: {
+                if (!parse_history_time(w.woptarg, opt == 6 ? &since : &until)) {
+                    streams.err.append_format(_(L"%ls: %ls value '%ls' is not a valid time\n"),
+                                              cmd, opt == 6 ? L"since" : L"until", w.woptarg);
+                    return STATUS_BUILTIN_ERROR;
+                }
+                time_range_defined = true;
+                break;
+            }
             case 'C': {
                 case_sensitive = true;
                 break;
@@ -3300,7 +3301,7 @@ static int builtin_history(parser_t &parser, io_streams_t &streams, wchar_t **ar
     switch (hist_cmd) {
         case HIST_SEARCH: {
             if (!history->search(search_type, args, show_time_format, max_items, case_sensitive,
-                                 null_terminate, streams)) {
+                                 null_terminate, streams, since, until)) {
                 status = STATUS_BUILTIN_ERROR;
             }
             break;
@@ -3314,6 +3315,12 @@ static int builtin_history(parser_t &parser, io_streams_t &streams, wchar_t **ar
                 status = STATUS_BUILTIN_ERROR;
                 break;
             }
+            if (time_range_defined) {
+                streams.err.append_format(
+                    _(L"builtin history delete does not support --since or --until\n"));
+                status = STATUS_BUILTIN_ERROR;
+                break;
+            }
             if (!case_sensitive) {
                 streams.err.append_format(
                     _(L"builtin history delete only supports --case-sensitive\n"));
@@ -3455,7 +3462,7 @@ int builtin_realpath(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
 // Functions that are bound to builtin_generic are handled directly by the parser.
 // NOTE: These must be kept in sorted order!
 static const builtin_data_t builtin_datas[] = {
-    {L"[", &builtin_test, N_(L"Test a condition")},
+    {L"[", &builtin_test, N_(L"Test a condition"), true},
 #if 0
     // Disabled for the 2.2.0 release: https://github.com/fish-shell/fish-shell/issues/1809.
     {       L"__fish_parse",  &builtin_parse, N_(L"Try out the new parser")  },
@@ -3477,8 +3484,8 @@ static const builtin_data_t builtin_datas[] = {
     {L"contains", &builtin_contains, N_(L"Search for a specified string in a list")},
     {L"continue", &builtin_break_continue,
      N_(L"Skip the rest of the current lap of the innermost loop")},
-    {L"count", &builtin_count, N_(L"Count the number of arguments")},
-    {L"echo", &builtin_echo, N_(L"Print arguments")},
+    {L"count", &builtin_count, N_(L"Count the number of arguments"), true},
+    {L"echo", &builtin_echo, N_(L"Print arguments"), true},
     {L"else", &builtin_generic, N_(L"Evaluate block if condition is false")},
     {L"emit", &builtin_emit, N_(L"Emit an event")},
     {L"end", &builtin_generic, N_(L"End a block of commands")},
@@ -3492,21 +3499,22 @@ static const builtin_data_t builtin_datas[] = {
     {L"history", &builtin_history, N_(L"History of commands executed by user")},
     {L"if", &builtin_generic, N_(L"Evaluate block if condition is true")},
     {L"jobs", &builtin_jobs, N_(L"Print currently running jobs")},
+    {L"math", &builtin_math, N_(L"Perform mathematics calculations"), true},
     {L"not", &builtin_generic, N_(L"Negate exit status of job")},
     {L"or", &builtin_generic, N_(L"Execute command if previous command failed")},
-    {L"printf", &builtin_printf, N_(L"Prints formatted text")},
-    {L"pwd", &builtin_pwd, N_(L"Print the working directory")},
+    {L"printf", &builtin_printf, N_(L"Prints formatted text"), true},
+    {L"pwd", &builtin_pwd, N_(L"Print the working directory"), true},
     {L"random", &builtin_random, N_(L"Generate random number")},
     {L"read", &builtin_read, N_(L"Read a line of input into variables")},
-    {L"realpath", &builtin_realpath, N_(L"Convert path to absolute path without symlinks")},
+    {L"realpath", &builtin_realpath, N_(L"Convert path to absolute path without symlinks"), true},
     {L"return", &builtin_return, N_(L"Stop the currently evaluated function")},
     {L"set", &builtin_set, N_(L"Handle environment variables")},
     {L"set_color", &builtin_set_color, N_(L"Set the terminal color")},
     {L"source", &builtin_source, N_(L"Evaluate contents of file")},
     {L"status", &builtin_status, N_(L"Return status information about fish")},
-    {L"string", &builtin_string, N_(L"Manipulate strings")},
+    {L"string", &builtin_string, N_(L"Manipulate strings"), true},
     {L"switch", &builtin_generic, N_(L"Conditionally execute a block of commands")},
-    {L"test", &builtin_test, N_(L"Test a condition")},
+    {L"test", &builtin_test, N_(L"Test a condition"), true},
     {L"true", &builtin_true, N_(L"Return a successful result")},
     {L"ulimit", &builtin_ulimit, N_(L"Set or get the shells resource usage limits")},
     {L"while", &builtin_generic, N_(L"Perform a command multiple times")}};
@@ -3570,7 +3578,10 @@ int builtin_run(parser_t &parser, const wchar_t *const *argv, io_streams_t &stre
         // result in the pointers being reordered. This is harmless because we only get called once
         // with a given argv array and nothing else will look at the contents of the array after we
         // return.
-        return data->func(parser, streams, (wchar_t **)argv);
+        int status = data->func(parser, streams, (wchar_t **)argv);
+        // Give back any input that the builtin read ahead but did not consume.
+        streams.release_stdin();
+        return status;
     }
 
     debug(0, UNKNOWN_BUILTIN_ERR_MSG, argv[0]);
@@ -3605,3 +3616,9 @@ wcstring builtin_get_desc(const wcstring &name) {
     }
     return result;
 }
+
+/// Returns whether the builtin with the given name can stream its output into a pipeline.
+bool builtin_can_stream(const wcstring &name) {
+    const builtin_data_t *builtin = builtin_lookup(name);
+    return builtin != NULL && builtin->can_stream_output;
+}
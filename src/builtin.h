@@ -20,6 +20,10 @@ struct builtin_data_t {
     int (*func)(parser_t &parser, io_streams_t &streams, wchar_t **argv);
     // Description of what the builtin does.
     const wchar_t *desc;
+    // Whether the builtin can stream its output into the processes after it in a pipeline. It
+    // must neither read the terminal nor run jobs in the foreground, since by the time it runs
+    // the terminal belongs to the rest of the job.
+    bool can_stream_output;
 
     bool operator<(const wcstring &) const;
     bool operator<(const builtin_data_t *) const;
@@ -82,6 +86,7 @@ int builtin_run(parser_t &parser, const wchar_t *const *argv, io_streams_t &stre
 wcstring_list_t builtin_get_names();
 void builtin_get_names(std::vector<completion_t> *list);
 wcstring builtin_get_desc(const wcstring &b);
+bool builtin_can_stream(const wcstring &name);
 
 /// Support for setting and removing transient command lines. This is used by
 /// 'complete -C' in order to make the commandline builtin operate on the string
@@ -0,0 +1,613 @@
+// Implementation of the math builtin.
+//
+// Expressions are evaluated in-process with arbitrary precision decimal numbers. This replaces the
+// math function that piped its arguments to bc, so the rules for the scale of results follow bc's.
+#include "config.h"  // IWYU pragma: keep
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+#include <wctype.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "builtin.h"
+#include "builtin_math.h"
+#include "common.h"
+#include "fallback.h"  // IWYU pragma: keep
+#include "io.h"
+#include "wutil.h"  // IWYU pragma: keep
+
+class parser_t;
+
+// These exit statuses match those of the math function.
+enum {
+    BUILTIN_MATH_OK = 0,
+    BUILTIN_MATH_ZERO = 1,
+    BUILTIN_MATH_USAGE = 2,
+    BUILTIN_MATH_ERROR = 3
+};
+
+/// The maximum number of digits in the scale or in any intermediate result. This keeps expressions
+/// like 9^9^9 from exhausting memory.
+#define MATH_MAX_DIGITS 100000
+
+/// Decimal digits, least significant first, with no leading (i.e. trailing) zeros.
+typedef std::vector<uint8_t> math_digits_t;
+
+/// An arbitrary precision decimal number, whose value is digits * 10^-scale.
+struct math_number_t {
+    math_digits_t digits;
+    size_t scale;
+    bool negative;
+
+    math_number_t() : scale(0), negative(false) {}
+
+    bool is_zero() const { return digits.empty(); }
+};
+
+static void trim_digits(math_digits_t *digits) {
+    while (!digits->empty() && digits->back() == 0) digits->pop_back();
+}
+
+static int compare_digits(const math_digits_t &a, const math_digits_t &b) {
+    if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+    for (size_t i = a.size(); i-- > 0;) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+static math_digits_t add_digits(const math_digits_t &a, const math_digits_t &b) {
+    math_digits_t result;
+    result.reserve(std::max(a.size(), b.size()) + 1);
+    unsigned carry = 0;
+    for (size_t i = 0; i < a.size() || i < b.size() || carry; i++) {
+        unsigned sum = carry + (i < a.size() ? a[i] : 0) + (i < b.size() ? b[i] : 0);
+        result.push_back(sum % 10);
+        carry = sum / 10;
+    }
+    return result;
+}
+
+/// Returns a - b. a must not be less than b.
+static math_digits_t subtract_digits(const math_digits_t &a, const math_digits_t &b) {
+    math_digits_t result(a);
+    int borrow = 0;
+    for (size_t i = 0; i < result.size(); i++) {
+        int diff = result[i] - borrow - (i < b.size() ? b[i] : 0);
+        borrow = diff < 0;
+        result[i] = static_cast<uint8_t>(borrow ? diff + 10 : diff);
+    }
+    trim_digits(&result);
+    return result;
+}
+
+static math_digits_t multiply_digits(const math_digits_t &a, const math_digits_t &b) {
+    if (a.empty() || b.empty()) return math_digits_t();
+    std::vector<unsigned long> sums(a.size() + b.size(), 0);
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i] == 0) continue;
+        for (size_t j = 0; j < b.size(); j++) {
+            sums[i + j] += a[i] * b[j];
+        }
+    }
+
+    math_digits_t result(sums.size(), 0);
+    unsigned long carry = 0;
+    for (size_t i = 0; i < sums.size(); i++) {
+        carry += sums[i];
+        result[i] = carry % 10;
+        carry /= 10;
+    }
+    trim_digits(&result);
+    return result;
+}
+
+/// Returns a / b, truncated. b must not be zero.
+static math_digits_t divide_digits(const math_digits_t &a, const math_digits_t &b) {
+    math_digits_t quotient(a.size(), 0);
+    math_digits_t remainder;
+    for (size_t i = a.size(); i-- > 0;) {
+        remainder.insert(remainder.begin(), a[i]);
+        trim_digits(&remainder);
+        uint8_t digit = 0;
+        while (compare_digits(remainder, b) >= 0) {
+            remainder = subtract_digits(remainder, b);
+            digit++;
+        }
+        quotient[i] = digit;
+    }
+    trim_digits(&quotient);
+    return quotient;
+}
+
+/// Multiply the digits by 10^count.
+static void shift_digits(math_digits_t *digits, size_t count) {
+    if (!digits->empty()) digits->insert(digits->begin(), count, 0);
+}
+
+/// Returns the square root of the digits, truncated.
+static math_digits_t sqrt_digits(const math_digits_t &a) {
+    if (a.empty()) return a;
+    math_digits_t two(1, 2);
+    // Newton's method, starting from 10^ceil(size / 2), which is not below the root. Each step
+    // lowers the estimate until it reaches the root.
+    math_digits_t root(1, 1);
+    shift_digits(&root, (a.size() + 1) / 2);
+    for (;;) {
+        math_digits_t next = divide_digits(add_digits(root, divide_digits(a, root)), two);
+        if (compare_digits(next, root) >= 0) break;
+        root.swap(next);
+    }
+    return root;
+}
+
+/// Change the scale of a number, truncating digits or appending zeros as needed.
+static void set_scale(math_number_t *num, size_t scale) {
+    if (scale >= num->scale) {
+        shift_digits(&num->digits, scale - num->scale);
+    } else {
+        size_t drop = std::min(num->scale - scale, num->digits.size());
+        num->digits.erase(num->digits.begin(), num->digits.begin() + drop);
+    }
+    num->scale = scale;
+    if (num->is_zero()) num->negative = false;
+}
+
+/// Formats a number the way bc does: without a leading zero before the decimal point, and as a
+/// plain 0 if the value is zero, whatever its scale.
+static wcstring format_number(const math_number_t &num) {
+    if (num.is_zero()) return L"0";
+
+    wcstring result;
+    if (num.negative) result.push_back(L'-');
+    for (size_t i = num.digits.size(); i-- > num.scale;) {
+        result.push_back(L'0' + num.digits[i]);
+    }
+    if (num.scale > 0) {
+        result.push_back(L'.');
+        for (size_t i = num.scale; i-- > 0;) {
+            result.push_back(i < num.digits.size() ? L'0' + num.digits[i] : L'0');
+        }
+    }
+    return result;
+}
+
+/// Evaluates an expression with bc's syntax and scale rules. Supports + - * / % ^, unary minus,
+/// parentheses, the comparisons < <= > >= == !=, the logical operators ! && || and sqrt(). Unary
+/// minus binds more tightly than ^, which is right associative. The comparisons bind more loosely
+/// than + and -, and more tightly than the logical operators, and all give 1 or 0.
+class math_evaluator_t {
+    const wcstring &expr;
+    // The scale used for division, and as the lower bound on the scale of other operations.
+    const size_t scale;
+    size_t pos;
+    // Set to a message on the first error, after which evaluation stops.
+    wcstring error;
+
+    void fail(const wchar_t *msg) {
+        if (error.empty()) error = msg;
+    }
+
+    bool check_size(const math_number_t &num) {
+        if (num.digits.size() > MATH_MAX_DIGITS || num.scale > MATH_MAX_DIGITS) {
+            fail(_(L"Result too large"));
+        }
+        return error.empty();
+    }
+
+    void skip_spaces() {
+        while (pos < expr.size() && iswspace(expr.at(pos))) pos++;
+    }
+
+    /// Returns the next non-space character without consuming it, or 0 at the end.
+    wchar_t peek() {
+        skip_spaces();
+        return pos < expr.size() ? expr.at(pos) : L'\0';
+    }
+
+    math_number_t add(const math_number_t &a, const math_number_t &b) {
+        math_number_t x = a, y = b;
+        size_t result_scale = std::max(a.scale, b.scale);
+        set_scale(&x, result_scale);
+        set_scale(&y, result_scale);
+
+        math_number_t result;
+        result.scale = result_scale;
+        if (x.negative == y.negative) {
+            result.digits = add_digits(x.digits, y.digits);
+            result.negative = x.negative;
+        } else if (compare_digits(x.digits, y.digits) >= 0) {
+            result.digits = subtract_digits(x.digits, y.digits);
+            result.negative = x.negative;
+        } else {
+            result.digits = subtract_digits(y.digits, x.digits);
+            result.negative = y.negative;
+        }
+        if (result.is_zero()) result.negative = false;
+        return result;
+    }
+
+    math_number_t negate(const math_number_t &a) {
+        math_number_t result = a;
+        result.negative = !a.negative && !a.is_zero();
+        return result;
+    }
+
+    math_number_t multiply(const math_number_t &a, const math_number_t &b, size_t min_scale) {
+        math_number_t result;
+        result.digits = multiply_digits(a.digits, b.digits);
+        result.scale = a.scale + b.scale;
+        result.negative = a.negative != b.negative;
+        set_scale(&result,
+                  std::min(a.scale + b.scale, std::max(min_scale, std::max(a.scale, b.scale))));
+        return result;
+    }
+
+    math_number_t divide(const math_number_t &a, const math_number_t &b, size_t result_scale) {
+        math_number_t result;
+        if (b.is_zero()) {
+            fail(_(L"Division by zero"));
+            return result;
+        }
+        // a / b * 10^scale == a.digits * 10^(b.scale + scale) / (b.digits * 10^a.scale)
+        math_digits_t numerator = a.digits, denominator = b.digits;
+        shift_digits(&numerator, b.scale + result_scale);
+        shift_digits(&denominator, a.scale);
+        result.digits = divide_digits(numerator, denominator);
+        result.scale = result_scale;
+        result.negative = a.negative != b.negative && !result.is_zero();
+        return result;
+    }
+
+    math_number_t modulo(const math_number_t &a, const math_number_t &b) {
+        // As in bc, a % b is a - (a / b) * b, with the quotient computed at the current scale.
+        math_number_t quotient = divide(a, b, scale);
+        if (!error.empty()) return quotient;
+        size_t result_scale = std::max(a.scale, b.scale + scale);
+        return add(a, negate(multiply(quotient, b, result_scale)));
+    }
+
+    math_number_t power(const math_number_t &a, const math_number_t &b) {
+        math_number_t result;
+        // Like bc, only the integer part of the exponent is used.
+        math_number_t exponent = b;
+        set_scale(&exponent, 0);
+        if (exponent.digits.size() > 9) {
+            fail(_(L"Exponent too large"));
+            return result;
+        }
+        size_t count = 0;
+        for (size_t i = exponent.digits.size(); i-- > 0;) count = count * 10 + exponent.digits[i];
+
+        result.digits.push_back(1);
+        if (count == 0) return result;
+        if (a.is_zero()) {
+            // Zero to a negative power is a division by zero.
+            return exponent.negative ? divide(result, a, scale) : a;
+        }
+
+        math_digits_t unit_digits(a.scale, 0);
+        unit_digits.push_back(1);
+        if (a.digits == unit_digits) {
+            // A base of 1 or -1 has a result of the same size whatever the exponent.
+            result.negative = a.negative && count % 2 == 1;
+        } else {
+            // The result has as many digits as the base's digits to the power of count, which is
+            // about count * log10(digits) of them.
+            double leading = 0;
+            size_t used = std::min(a.digits.size(), size_t(15));
+            for (size_t i = a.digits.size(); i-- > a.digits.size() - used;) {
+                leading = leading * 10 + a.digits[i];
+            }
+            double magnitude = log10(leading) + double(a.digits.size() - used);
+            if (magnitude * count > MATH_MAX_DIGITS) {
+                fail(_(L"Result too large"));
+                return math_number_t();
+            }
+
+            // Compute the exact power by repeated squaring.
+            math_number_t base = a;
+            for (size_t remaining = count;;) {
+                if (remaining & 1) {
+                    result.digits = multiply_digits(result.digits, base.digits);
+                    result.scale += base.scale;
+                    result.negative = result.negative != base.negative;
+                }
+                remaining >>= 1;
+                if (remaining == 0) break;
+                base.digits = multiply_digits(base.digits, base.digits);
+                base.scale *= 2;
+                base.negative = false;
+            }
+            if (result.is_zero()) result.negative = false;
+        }
+
+        if (exponent.negative) {
+            math_number_t one;
+            one.digits.push_back(1);
+            return divide(one, result, scale);
+        }
+        // The scale is min(a.scale * count, max(scale, a.scale)), without overflowing.
+        size_t max_scale = std::max(scale, a.scale);
+        set_scale(&result,
+                  a.scale == 0 || count <= max_scale / a.scale ? a.scale * count : max_scale);
+        return result;
+    }
+
+    math_number_t square_root(const math_number_t &a) {
+        if (a.negative) {
+            fail(_(L"Square root of a negative number"));
+            return math_number_t();
+        }
+        // As in bc, the root has the larger of the current scale and the argument's scale.
+        // root * 10^-s == sqrt(a.digits * 10^(2s - a.scale))
+        math_number_t result;
+        result.scale = std::max(scale, a.scale);
+        math_digits_t radicand = a.digits;
+        shift_digits(&radicand, 2 * result.scale - a.scale);
+        result.digits = sqrt_digits(radicand);
+        return result;
+    }
+
+    /// Returns 1 if the condition holds, else 0.
+    static math_number_t truth_value(bool condition) {
+        math_number_t result;
+        if (condition) result.digits.push_back(1);
+        return result;
+    }
+
+    /// Returns a negative number, zero or a positive number as a is less than, equal to or greater
+    /// than b.
+    int compare(const math_number_t &a, const math_number_t &b) {
+        math_number_t difference = add(a, negate(b));
+        if (difference.is_zero()) return 0;
+        return difference.negative ? -1 : 1;
+    }
+
+    /// Consumes the operator at pos if it is one of ops, and returns it, or an empty string.
+    wcstring take_operator(const wchar_t *const *ops) {
+        skip_spaces();
+        for (; *ops; ops++) {
+            size_t len = wcslen(*ops);
+            if (expr.compare(pos, len, *ops) == 0) {
+                pos += len;
+                return *ops;
+            }
+        }
+        return wcstring();
+    }
+
+    math_number_t parse_number() {
+        math_number_t result;
+        size_t start = pos;
+        wcstring integer_part, fraction_part;
+        while (pos < expr.size() && iswdigit(expr.at(pos))) integer_part.push_back(expr.at(pos++));
+        if (pos < expr.size() && expr.at(pos) == L'.') {
+            pos++;
+            while (pos < expr.size() && iswdigit(expr.at(pos))) {
+                fraction_part.push_back(expr.at(pos++));
+            }
+        }
+        if (integer_part.empty() && fraction_part.empty()) {
+            pos = start;
+            fail(_(L"Invalid expression"));
+            return result;
+        }
+
+        wcstring all_digits = integer_part + fraction_part;
+        for (size_t i = all_digits.size(); i-- > 0;) {
+            result.digits.push_back(static_cast<uint8_t>(all_digits.at(i) - L'0'));
+        }
+        trim_digits(&result.digits);
+        result.scale = fraction_part.size();
+        check_size(result);
+        return result;
+    }
+
+    math_number_t parse_primary() {
+        if (peek() == L'(') {
+            pos++;
+            math_number_t result = parse_or();
+            if (error.empty() && peek() != L')') fail(_(L"Missing closing parenthesis"));
+            pos++;
+            return result;
+        }
+        if (iswalpha(peek())) {
+            size_t start = pos;
+            while (pos < expr.size() && iswalnum(expr.at(pos))) pos++;
+            if (expr.compare(start, pos - start, L"sqrt") != 0 || peek() != L'(') {
+                pos = start;
+                fail(_(L"Unsupported function or variable"));
+                return math_number_t();
+            }
+            math_number_t argument = parse_primary();
+            return error.empty() ? square_root(argument) : argument;
+        }
+        return parse_number();
+    }
+
+    math_number_t parse_unary() {
+        if (peek() == L'-') {
+            pos++;
+            return negate(parse_unary());
+        }
+        return parse_primary();
+    }
+
+    math_number_t parse_power() {
+        math_number_t result = parse_unary();
+        if (error.empty() && peek() == L'^') {
+            pos++;
+            math_number_t exponent = parse_power();
+            if (error.empty()) result = power(result, exponent);
+        }
+        return result;
+    }
+
+    math_number_t parse_product() {
+        math_number_t result = parse_power();
+        for (;;) {
+            wchar_t op = peek();
+            if (!error.empty() || (op != L'*' && op != L'/' && op != L'%')) break;
+            pos++;
+            math_number_t operand = parse_power();
+            if (!error.empty()) break;
+            if (op == L'*') {
+                result = multiply(result, operand, scale);
+            } else if (op == L'/') {
+                result = divide(result, operand, scale);
+            } else {
+                result = modulo(result, operand);
+            }
+            if (!check_size(result)) break;
+        }
+        return result;
+    }
+
+    math_number_t parse_sum() {
+        math_number_t result = parse_product();
+        for (;;) {
+            wchar_t op = peek();
+            if (!error.empty() || (op != L'+' && op != L'-')) break;
+            pos++;
+            math_number_t operand = parse_product();
+            if (!error.empty()) break;
+            result = add(result, op == L'+' ? operand : negate(operand));
+            if (!check_size(result)) break;
+        }
+        return result;
+    }
+
+    math_number_t parse_comparison() {
+        static const wchar_t *const ops[] = {L"<=", L">=", L"==", L"!=", L"<", L">", NULL};
+        math_number_t result = parse_sum();
+        for (;;) {
+            if (!error.empty()) break;
+            const wcstring op = take_operator(ops);
+            if (op.empty()) break;
+            math_number_t operand = parse_sum();
+            if (!error.empty()) break;
+            int cmp = compare(result, operand);
+            if (op == L"<=") {
+                result = truth_value(cmp <= 0);
+            } else if (op == L">=") {
+                result = truth_value(cmp >= 0);
+            } else if (op == L"==") {
+                result = truth_value(cmp == 0);
+            } else if (op == L"!=") {
+                result = truth_value(cmp != 0);
+            } else if (op == L"<") {
+                result = truth_value(cmp < 0);
+            } else {
+                result = truth_value(cmp > 0);
+            }
+        }
+        return result;
+    }
+
+    math_number_t parse_not() {
+        // A lone ! is logical not; != is only valid between operands.
+        if (peek() == L'!' && expr.compare(pos, 2, L"!=") != 0) {
+            pos++;
+            math_number_t operand = parse_not();
+            return error.empty() ? truth_value(operand.is_zero()) : operand;
+        }
+        return parse_comparison();
+    }
+
+    math_number_t parse_and() {
+        static const wchar_t *const ops[] = {L"&&", NULL};
+        math_number_t result = parse_not();
+        while (error.empty() && !take_operator(ops).empty()) {
+            math_number_t operand = parse_not();
+            if (!error.empty()) break;
+            result = truth_value(!result.is_zero() && !operand.is_zero());
+        }
+        return result;
+    }
+
+    math_number_t parse_or() {
+        static const wchar_t *const ops[] = {L"||", NULL};
+        math_number_t result = parse_and();
+        while (error.empty() && !take_operator(ops).empty()) {
+            math_number_t operand = parse_and();
+            if (!error.empty()) break;
+            result = truth_value(!result.is_zero() || !operand.is_zero());
+        }
+        return result;
+    }
+
+   public:
+    math_evaluator_t(const wcstring &e, size_t s) : expr(e), scale(s), pos(0) {}
+
+    /// Evaluates the expression, returning false and setting out_err on failure.
+    bool evaluate(math_number_t *out_result, wcstring *out_err) {
+        math_number_t result = parse_or();
+        if (error.empty() && peek() != L'\0') fail(_(L"Invalid expression"));
+        if (!error.empty()) {
+            *out_err = error;
+            return false;
+        }
+        *out_result = result;
+        return true;
+    }
+};
+
+/// The math builtin, for performing arithmetic.
+int builtin_math(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
+    const wchar_t *cmd = argv[0];
+    int argc = builtin_count_args(argv);
+    int argidx = 1;
+    size_t scale = 0;  // default is integer arithmetic
+
+    // Options are parsed by hand rather than with wgetopt, so that an expression like "-1 + 2" is
+    // not mistaken for an option.
+    if (argc > 1) {
+        const wchar_t *arg = argv[1];
+        if (wcsncmp(arg, L"-s", 2) == 0) {
+            const wchar_t *scale_str = arg + 2;
+            bool valid = *scale_str != L'\0' && wcslen(scale_str) < 10;
+            for (const wchar_t *c = scale_str; valid && *c; c++) valid = iswdigit(*c);
+            if (!valid) {
+                streams.err.append_format(_(L"%ls: Expected an integer to follow -s\n"), cmd);
+                return BUILTIN_MATH_USAGE;
+            }
+            scale = static_cast<size_t>(fish_wcstoll(scale_str));
+            if (scale > MATH_MAX_DIGITS) {
+                streams.err.append_format(_(L"%ls: Scale %ls is too large\n"), cmd, scale_str);
+                return BUILTIN_MATH_USAGE;
+            }
+            argidx++;
+        } else if (!wcscmp(arg, L"-h") || !wcscmp(arg, L"--h") || !wcscmp(arg, L"--he") ||
+                   !wcscmp(arg, L"--hel") || !wcscmp(arg, L"--help")) {
+            builtin_print_help(parser, streams, cmd, streams.out);
+            return BUILTIN_MATH_OK;
+        }
+    }
+
+    // No expression is an error.
+    if (argidx >= argc) return BUILTIN_MATH_USAGE;
+
+    wcstring expression;
+    for (int i = argidx; i < argc; i++) {
+        if (i > argidx) expression.push_back(L' ');
+        expression.append(argv[i]);
+    }
+
+    math_number_t result;
+    wcstring error;
+    math_evaluator_t evaluator(expression, scale);
+    if (!evaluator.evaluate(&result, &error)) {
+        streams.err.append_format(L"%ls: %ls: '%ls'\n", cmd, error.c_str(), expression.c_str());
+        return BUILTIN_MATH_ERROR;
+    }
+
+    streams.out.append(format_number(result));
+    streams.out.push_back(L'\n');
+    // For historical reasons a zero result translates to a failure status.
+    return result.is_zero() ? BUILTIN_MATH_ZERO : BUILTIN_MATH_OK;
+}
@@ -0,0 +1,11 @@
+// Prototypes for functions for executing builtin_math functions.
+#ifndef FISH_BUILTIN_MATH_H
+#define FISH_BUILTIN_MATH_H
+
+#include <wchar.h>
+#include <cstring>
+
+class parser_t;
+
+int builtin_math(parser_t &parser, io_streams_t &streams, wchar_t **argv);
+#endif
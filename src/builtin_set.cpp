@@ -42,11 +42,9 @@ static int is_path_variable(const wchar_t *env) { return contains(env, L"PATH",
 
 /// Call env_set. If this is a path variable, e.g. PATH, validate the elements. On error, print a
 /// description of the problem to stderr.
-static int my_env_set(const wchar_t *key, const wcstring_list_t &val, int scope,
-                      io_streams_t &streams) {
+static int my_env_set(const wchar_t *key, wcstring_list_t val, int scope, io_streams_t &streams) {
     size_t i;
     int retcode = 0;
-    const wchar_t *val_str = NULL;
 
     if (is_path_variable(key)) {
         // Fix for https://github.com/fish-shell/fish-shell/issues/199 . Return success if any path
@@ -62,10 +60,9 @@ static int my_env_set(const wchar_t *key, const wcstring_list_t &val, int scope,
         // where we are temporarily shadowing a variable, we want to compare against the shadowed
         // value, not the (missing) local value. Also don't bother to complain about relative paths,
         // which don't start with /.
-        wcstring_list_t existing_values;
-        const env_var_t existing_variable = env_get_string(key, ENV_DEFAULT);
-        if (!existing_variable.missing_or_empty())
-            tokenize_variable_array(existing_variable, existing_values);
+        const env_list_ref_t existing_variable = env_get_list(key, ENV_DEFAULT);
+        const wcstring_list_t existing_values =
+            existing_variable ? *existing_variable : wcstring_list_t();
 
         for (i = 0; i < val.size(); i++) {
             const wcstring &dir = val.at(i);
@@ -111,18 +108,7 @@ static int my_env_set(const wchar_t *key, const wcstring_list_t &val, int scope,
         }
     }
 
-    wcstring sb;
-    if (!val.empty()) {
-        for (i = 0; i < val.size(); i++) {
-            sb.append(val[i]);
-            if (i < val.size() - 1) {
-                sb.append(ARRAY_SEP_STR);
-            }
-        }
-        val_str = sb.c_str();
-    }
-
-    switch (env_set(key, val_str, scope | ENV_USER)) {
+    switch (env_set_list(key, std::move(val), scope | ENV_USER)) {
         case ENV_OK: {
             break;
         }
@@ -462,20 +448,19 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
 
             if (slice) {
                 std::vector<long> indexes;
-                wcstring_list_t result;
                 size_t j;
 
-                env_var_t dest_str = env_get_string(dest, scope);
-                if (!dest_str.missing()) tokenize_variable_array(dest_str, result);
+                const env_list_ref_t dest_vals = env_get_list(dest, scope);
+                const size_t dest_count = dest_vals ? dest_vals->size() : 0;
 
-                if (!parse_index(indexes, arg, dest, result.size(), streams)) {
+                if (!parse_index(indexes, arg, dest, dest_count, streams)) {
                     builtin_print_help(parser, streams, argv[0], streams.err);
                     retcode = 1;
                     break;
                 }
                 for (j = 0; j < indexes.size(); j++) {
                     long idx = indexes[j];
-                    if (idx < 1 || (size_t)idx > result.size()) {
+                    if (idx < 1 || (size_t)idx > dest_count) {
                         retcode++;
                     }
                 }
@@ -533,9 +518,9 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
         std::vector<long> indexes;
         wcstring_list_t result;
 
-        const env_var_t dest_str = env_get_string(dest, scope);
-        if (!dest_str.missing()) {
-            tokenize_variable_array(dest_str, result);
+        const env_list_ref_t dest_vals = env_get_list(dest, scope);
+        if (dest_vals) {
+            result = *dest_vals;
         } else if (erase) {
             retcode = 1;
         }
@@ -570,7 +555,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
             // Slice indexes have been calculated, do the actual work.
             if (erase) {
                 erase_values(result, indexes);
-                my_env_set(dest, result, scope, streams);
+                my_env_set(dest, std::move(result), scope, streams);
             } else {
                 wcstring_list_t value;
 
@@ -584,7 +569,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
                     streams.err.push_back(L'\n');
                 }
 
-                my_env_set(dest, result, scope, streams);
+                my_env_set(dest, std::move(result), scope, streams);
             }
         }
     } else {
@@ -602,7 +587,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
         } else {
             wcstring_list_t val;
             for (int i = w.woptind; i < argc; i++) val.push_back(argv[i]);
-            retcode = my_env_set(dest, val, scope, streams);
+            retcode = my_env_set(dest, std::move(val), scope, streams);
         }
     }
 
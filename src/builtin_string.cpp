@@ -53,28 +53,15 @@ static bool string_args_from_stdin(const io_streams_t &streams) {
     return streams.stdin_is_directly_redirected;
 }
 
-static const wchar_t *string_get_arg_stdin(wcstring *storage, const io_streams_t &streams) {
-    std::string arg;
-    for (;;) {
-        char ch = '\0';
-        long rc = read_blocked(streams.stdin_fd, &ch, 1);
-
-        if (rc < 0) {  // failure
-            return 0;
-        }
-
-        if (rc == 0) {  // EOF
-            if (arg.empty()) {
-                return 0;
-            }
-            break;
-        }
-
-        if (ch == '\n') {
-            break;
-        }
+static const wchar_t *string_get_arg_stdin(wcstring *storage, io_streams_t &streams) {
+    // Stop reading input once nothing reads our output.
+    if (streams.out.write_failed()) {
+        return 0;
+    }
 
-        arg += ch;
+    std::string arg;
+    if (!streams.stdin_stream().read_until('\n', &arg)) {
+        return 0;
     }
 
     *storage = str2wcstring(arg);
@@ -86,7 +73,7 @@ static const wchar_t *string_get_arg_argv(int *argidx, wchar_t **argv) {
 }
 
 static const wchar_t *string_get_arg(int *argidx, wchar_t **argv, wcstring *storage,
-                                     const io_streams_t &streams) {
+                                     io_streams_t &streams) {
     if (string_args_from_stdin(streams)) {
         return string_get_arg_stdin(storage, streams);
     }
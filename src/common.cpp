@@ -1466,6 +1466,19 @@ void tokenize_variable_array(const wcstring &val, std::vector<wcstring> &out) {
     }
 }
 
+wcstring join_variable_array(const wcstring_list_t &vals) {
+    size_t len = vals.size();
+    for (size_t i = 0; i < vals.size(); i++) len += vals[i].size();
+
+    wcstring result;
+    result.reserve(len);
+    for (size_t i = 0; i < vals.size(); i++) {
+        if (i > 0) result.push_back(ARRAY_SEP);
+        result.append(vals[i]);
+    }
+    return result;
+}
+
 bool string_prefixes_string(const wchar_t *proposed_prefix, const wcstring &value) {
     size_t prefix_size = wcslen(proposed_prefix);
     return prefix_size <= value.size() && value.compare(0, prefix_size, proposed_prefix) == 0;
@@ -791,6 +791,10 @@ wcstring reformat_for_screen(const wcstring &msg);
 /// \param out the list in which to place the elements.
 void tokenize_variable_array(const wcstring &val, wcstring_list_t &out);
 
+/// Join the elements of an array variable with ARRAY_SEP. This is the inverse of
+/// tokenize_variable_array for any nonempty list.
+wcstring join_variable_array(const wcstring_list_t &vals);
+
 /// Make sure the specified direcotry exists. If needed, try to create it and any currently not
 /// existing parent directories.
 ///
@@ -31,6 +31,7 @@
 #include "env.h"
 #include "env_universal_common.h"
 #include "event.h"
+#include "exec.h"
 #include "expand.h"
 #include "fallback.h"  // IWYU pragma: keep
 #include "fish_version.h"
@@ -57,6 +58,7 @@
 extern char **environ;
 
 bool g_use_posix_spawn = false;  // will usually be set to true
+bool g_use_vfork = false;        // likewise, where vfork is used at all
 
 /// Does the terminal have the "eat_newline_glitch".
 bool term_has_xn = false;
@@ -71,6 +73,152 @@ static const wchar_t *const locale_variable[] = {
 /// List of all curses environment variable names.
 static const wchar_t *const curses_variable[] = {L"TERM", L"TERMINFO", L"TERMINFO_DIRS", NULL};
 
+/// Returns the FNV-1a hash of a variable name.
+static size_t hash_var_name(const wchar_t *name) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const wchar_t *c = name; *c; c++) {
+        hash = (hash ^ static_cast<uint64_t>(*c)) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
+/// A variable name together with its hash. Lookups construct this once, so that searching several
+/// scopes does not rehash the name in each of them.
+struct var_key_t {
+    const wchar_t *const name;
+    const size_t hash;
+
+    explicit var_key_t(const wchar_t *n) : name(n), hash(hash_var_name(n)) {}
+    explicit var_key_t(const wcstring &n) : name(n.c_str()), hash(hash_var_name(n.c_str())) {}
+};
+
+/// A variable in the function variable stack. Arrays are stored as their list of elements, and are
+/// only joined with ARRAY_SEP when read as a string or exported.
+struct scope_var_t {
+    /// The elements of the variable. An empty list is a zero element array.
+    env_list_ref_t vals;
+    /// Whether the variable should be exported.
+    bool exportv = false;
+
+    /// Returns whether this is a zero element array.
+    bool is_empty_array() const { return !vals || vals->empty(); }
+
+    /// Returns the elements joined with ARRAY_SEP.
+    wcstring as_string() const {
+        if (is_empty_array()) return wcstring();
+        if (vals->size() == 1) return vals->front();
+        return join_variable_array(*vals);
+    }
+};
+
+/// The variables of one scope: a hash table using open addressing with linear probing. Each slot
+/// stores the hash of its name, so that a probe only compares strings when the hashes match.
+class var_scope_table_t {
+    struct slot_t {
+        /// Whether the slot holds a variable.
+        bool used;
+        wcstring name;
+        size_t hash;
+        scope_var_t entry;
+
+        slot_t() : used(false), hash(0) {}
+    };
+
+    /// The slots. The count is zero or a power of two.
+    std::vector<slot_t> slots;
+    /// Number of occupied slots.
+    size_t count;
+
+    static bool slot_matches(const slot_t &slot, const var_key_t &key) {
+        return slot.hash == key.hash && !wcscmp(slot.name.c_str(), key.name);
+    }
+
+    /// Returns the index of the slot holding key, or of the empty slot where it would be inserted.
+    /// There must be at least one slot.
+    size_t find_slot(const var_key_t &key) const {
+        const size_t mask = slots.size() - 1;
+        size_t idx = key.hash & mask;
+        while (slots[idx].used && !slot_matches(slots[idx], key)) {
+            idx = (idx + 1) & mask;
+        }
+        return idx;
+    }
+
+    void grow() {
+        std::vector<slot_t> old_slots;
+        old_slots.swap(slots);
+        slots.resize(old_slots.empty() ? 8 : old_slots.size() * 2);
+        const size_t mask = slots.size() - 1;
+        for (slot_t &old_slot : old_slots) {
+            if (!old_slot.used) continue;
+            size_t idx = old_slot.hash & mask;
+            while (slots[idx].used) idx = (idx + 1) & mask;
+            slots[idx] = std::move(old_slot);
+        }
+    }
+
+   public:
+    var_scope_table_t() : count(0) {}
+
+    size_t size() const { return count; }
+
+    /// Returns the entry for the given key, or NULL if there is none.
+    scope_var_t *find(const var_key_t &key) {
+        if (slots.empty()) return NULL;
+        slot_t &slot = slots[find_slot(key)];
+        return slot.used ? &slot.entry : NULL;
+    }
+
+    const scope_var_t *find(const var_key_t &key) const {
+        return const_cast<var_scope_table_t *>(this)->find(key);
+    }
+
+    /// Returns the entry for the given key, creating an empty one if there is none.
+    scope_var_t &get_or_insert(const var_key_t &key) {
+        // Keep the load factor at most 3/4.
+        if ((count + 1) * 4 > slots.size() * 3) grow();
+        slot_t &slot = slots[find_slot(key)];
+        if (!slot.used) {
+            slot.used = true;
+            slot.name = key.name;
+            slot.hash = key.hash;
+            count++;
+        }
+        return slot.entry;
+    }
+
+    /// Removes the entry for the given key. Returns true if there was one.
+    bool erase(const var_key_t &key) {
+        if (slots.empty()) return false;
+        const size_t mask = slots.size() - 1;
+        size_t hole = find_slot(key);
+        if (!slots[hole].used) return false;
+        slots[hole] = slot_t();
+        count--;
+
+        // Shift later entries of the probe sequence back into the hole, so that lookups never stop
+        // early at it. An entry may move only if its home slot is not cyclically in (hole, idx].
+        for (size_t idx = (hole + 1) & mask; slots[idx].used; idx = (idx + 1) & mask) {
+            size_t home = slots[idx].hash & mask;
+            bool stays = hole <= idx ? (hole < home && home <= idx) : (hole < home || home <= idx);
+            if (!stays) {
+                slots[hole] = std::move(slots[idx]);
+                slots[idx] = slot_t();
+                hole = idx;
+            }
+        }
+        return true;
+    }
+
+    /// Calls func(name, entry) for each variable, in no particular order.
+    template <typename Func>
+    void for_each(Func func) const {
+        for (const slot_t &slot : slots) {
+            if (slot.used) func(slot.name.c_str(), slot.entry);
+        }
+    }
+};
+
 // Struct representing one level in the function variable stack.
 // Only our variable stack should create and destroy these
 class env_node_t {
@@ -79,7 +227,7 @@ class env_node_t {
 
    public:
     /// Variable table.
-    var_table_t env;
+    var_scope_table_t env;
     /// Does this node imply a new variable scope? If yes, all non-global variables below this one
     /// in the stack are invisible. If new_scope is set for the global variable node, the universe
     /// will explode.
@@ -90,7 +238,7 @@ class env_node_t {
     std::unique_ptr<env_node_t> next;
 
     /// Returns a pointer to the given entry if present, or NULL.
-    const var_entry_t *find_entry(const wcstring &key);
+    const scope_var_t *find_entry(const var_key_t &key) const { return env.find(key); }
 };
 
 class variable_entry_t {
@@ -99,7 +247,6 @@ class variable_entry_t {
 
 static pthread_mutex_t env_lock = PTHREAD_MUTEX_INITIALIZER;
 
-static bool local_scope_exports(const env_node_t *n);
 static void handle_locale(const wchar_t *env_var_name);
 
 // A class wrapping up a variable stack
@@ -114,12 +261,33 @@ struct var_stack_t {
     // This is an observer pointer
     env_node_t *global_env = NULL;
 
-    // Exported variable array used by execv.
-    null_terminated_array_t<char> export_array;
+    // Exported variables as narrow "key=value" strings, keyed by variable name.
+    std::map<wcstring, std::string> export_strings;
+
+    // Null terminated array of pointers into export_strings, used by execv.
+    std::vector<const char *> export_array;
 
-    /// Flag for checking if we need to regenerate the exported variable array.
+    // Names of every variable that has ever been exported. Setting or hiding any other variable
+    // cannot change the export array, so changes to those are not tracked.
+    std::set<wcstring> exportable_keys;
+
+    // Names of variables whose exported value may have changed since the last update.
+    std::set<wcstring> changed_exported_keys;
+
+    /// Flag for checking if we need to regenerate the whole exported variable array.
     bool has_changed_exported = true;
     void mark_changed_exported() { has_changed_exported = true; }
+
+    /// Note that the given variable may have changed its exported value. If is_exported is set,
+    /// the variable becomes exportable.
+    void mark_changed_exported(const wcstring &key, bool is_exported = false);
+
+    /// Note that every variable in the given node may have changed its exported value.
+    void mark_node_changed_exported(const env_node_t *node);
+
+    /// Returns the value the given variable is exported with, or false if it is not exported.
+    bool get_exported_value(const wcstring &key, wcstring *out_val) const;
+
     void update_export_array_if_necessary();
 
     var_stack_t() : top(new env_node_t(false)) { this->global_env = this->top.get(); }
@@ -146,8 +314,12 @@ void var_stack_t::push(bool new_scope) {
     std::unique_ptr<env_node_t> node(new env_node_t(new_scope));
     node->next = std::move(this->top);
     this->top = std::move(node);
-    if (new_scope && local_scope_exports(this->top.get())) {
-        this->mark_changed_exported();
+    if (new_scope) {
+        // Locals of the scopes below are now hidden.
+        for (const env_node_t *n = this->top->next.get(); n != this->global_env; n = n->next.get()) {
+            this->mark_node_changed_exported(n);
+            if (n->new_scope) break;
+        }
     }
 }
 
@@ -162,18 +334,13 @@ void var_stack_t::pop() {
     const wchar_t *locale_changed = NULL;
 
     for (int i = 0; locale_variable[i]; i++) {
-        var_table_t::iterator result = top->env.find(locale_variable[i]);
-        if (result != top->env.end()) {
+        if (top->find_entry(var_key_t(locale_variable[i])) != NULL) {
             locale_changed = locale_variable[i];
             break;
         }
     }
-
-    if (top->new_scope) {  //!OCLINT(collapsible if statements)
-        if (top->exportv || local_scope_exports(top->next.get())) {
-            this->mark_changed_exported();
-        }
-    }
+    const bool concurrent_cmdsubst_changed =
+        top->find_entry(var_key_t(L"fish_concurrent_cmdsubst")) != NULL;
 
     // Actually do the pop! Move the top pointer into a local variable, then replace the top pointer
     // with the next pointer afterwards we should have a node with no next pointer, and our top
@@ -184,16 +351,17 @@ void var_stack_t::pop() {
     assert(this->top && old_top && !old_top->next);
     assert(this->top != NULL);
 
-    var_table_t::iterator iter;
-    for (const auto &entry_pair : old_top->env) {
-        const var_entry_t &entry = entry_pair.second;
-        if (entry.exportv) {
-            this->mark_changed_exported();
-            break;
+    this->mark_node_changed_exported(old_top.get());
+    if (old_top->new_scope) {
+        // Locals of the scopes below are visible again.
+        for (const env_node_t *n = this->top.get(); n != this->global_env; n = n->next.get()) {
+            this->mark_node_changed_exported(n);
+            if (n->new_scope) break;
         }
     }
     // TODO: Move this to something general.
     if (locale_changed) handle_locale(locale_changed);
+    if (concurrent_cmdsubst_changed) update_concurrent_cmdsubst();
 }
 
 const env_node_t *var_stack_t::next_scope_to_search(const env_node_t *node) const {
@@ -254,15 +422,6 @@ static bool is_electric(const wcstring &key) {
     return env_electric.find(key.c_str()) != env_electric.end();
 }
 
-const var_entry_t *env_node_t::find_entry(const wcstring &key) {
-    const var_entry_t *result = NULL;
-    var_table_t::const_iterator where = env.find(key);
-    if (where != env.end()) {
-        result = &where->second;
-    }
-    return result;
-}
-
 /// Return the current umask value.
 static mode_t get_umask() {
     mode_t res;
@@ -418,6 +577,12 @@ static void react_to_variable_change(const wcstring &key) {
         reader_react_to_color_change();
     } else if (key == L"fish_escape_delay_ms") {
         update_wait_on_escape_ms();
+    } else if (key == L"fish_history_flush_items" || key == L"fish_history_flush_delay_ms") {
+        update_history_flush_policy();
+    } else if (key == L"fish_read_limit") {
+        update_read_limit();
+    } else if (key == L"fish_concurrent_cmdsubst") {
+        update_concurrent_cmdsubst();
     } else if (key == L"LINES" || key == L"COLUMNS") {
         invalidate_termsize(true);  // force fish to update its idea of the terminal size plus vars
     }
@@ -441,7 +606,7 @@ static void universal_callback(fish_message_type_t type, const wchar_t *name) {
     }
 
     if (str) {
-        vars_stack().mark_changed_exported();
+        vars_stack().mark_changed_exported(name, type == SET_EXPORT);
 
         event_t ev = event_t::variable_event(name);
         ev.arguments.push_back(L"VARIABLE");
@@ -612,12 +777,18 @@ void env_init(const struct config_paths_t *paths /* or NULL */) {
     assert(s_universal_variables == NULL);
     s_universal_variables = new env_universal_t(L"");
     s_universal_variables->load();
+    update_read_limit();
+    update_concurrent_cmdsubst();
 
     // Set g_use_posix_spawn. Default to true.
     env_var_t use_posix_spawn = env_get_string(L"fish_use_posix_spawn");
     g_use_posix_spawn =
         (use_posix_spawn.missing_or_empty() ? true : from_string<bool>(use_posix_spawn));
 
+    // Set g_use_vfork. Default to true.
+    env_var_t use_vfork = env_get_string(L"fish_use_vfork");
+    g_use_vfork = (use_vfork.missing_or_empty() ? true : from_string<bool>(use_vfork));
+
     // Set fish_bind_mode to "default".
     env_set(FISH_BIND_MODE_VAR, DEFAULT_BIND_MODE, ENV_GLOBAL);
 
@@ -629,7 +800,7 @@ void env_init(const struct config_paths_t *paths /* or NULL */) {
 
 /// Search all visible scopes in order for the specified key. Return the first scope in which it was
 /// found.
-static env_node_t *env_get_node(const wcstring &key) {
+static env_node_t *env_get_node(const var_key_t &key) {
     env_node_t *env = vars_stack().top.get();
     while (env != NULL) {
         if (env->find_entry(key) != NULL) {
@@ -661,16 +832,27 @@ static env_node_t *env_get_node(const wcstring &key) {
 /// variables set from the local or universal scopes, or set as exported.
 /// * ENV_INVALID, the variable value was invalid. This applies only to special variables.
 int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode) {
+    // Zero element arrays are passed as null or as the ENV_NULL placeholder string.
+    wcstring_list_t vals;
+    if (val && wcscmp(val, ENV_NULL)) tokenize_variable_array(val, vals);
+    return env_set_list(key, std::move(vals), var_mode);
+}
+
+/// Returns the string universal variables store for the given elements. Zero element arrays are
+/// internally not coded as an empty string but as the ENV_NULL placeholder.
+static wcstring uvar_string(const wcstring_list_t &vals) {
+    return vals.empty() ? wcstring(ENV_NULL) : join_variable_array(vals);
+}
+
+/// Set the variable whose name matches key to the list of elements vals. See env_set.
+int env_set_list(const wcstring &key, wcstring_list_t vals, env_mode_flags_t var_mode) {
     ASSERT_IS_MAIN_THREAD();
-    bool has_changed_old = vars_stack().has_changed_exported;
     int done = 0;
 
-    if (val && contains(key, L"PWD", L"HOME")) {
-        // Canonicalize our path; if it changes, recurse and try again.
-        wcstring val_canonical = val;
-        path_make_canonical(val_canonical);
-        if (val != val_canonical) {
-            return env_set(key, val_canonical.c_str(), var_mode);
+    if (contains(key, L"PWD", L"HOME")) {
+        // Canonicalize our path.
+        for (size_t i = 0; i < vals.size(); i++) {
+            path_make_canonical(vals[i]);
         }
     }
 
@@ -686,8 +868,9 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
 
     if (key == L"umask") {
         // Set the new umask.
-        if (val && wcslen(val)) {
-            long mask = fish_wcstol(val, NULL, 8);
+        const wcstring val = join_variable_array(vals);
+        if (!val.empty()) {
+            long mask = fish_wcstol(val.c_str(), NULL, 8);
             if (!errno && mask <= 0777 && mask >= 0) {
                 umask(mask);
                 // Do not actually create a umask variable, on env_get, it will be calculated
@@ -699,11 +882,6 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
         return ENV_INVALID;
     }
 
-    // Zero element arrays are internaly not coded as null but as this placeholder string.
-    if (!val) {
-        val = ENV_NULL;  //!OCLINT(parameter reassignment)
-    }
-
     if (var_mode & ENV_UNIVERSAL) {
         const bool old_export = uvars() && uvars()->get_export(key);
         bool new_export;
@@ -718,24 +896,23 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
             new_export = old_export;
         }
         if (uvars()) {
-            uvars()->set(key, val, new_export);
+            uvars()->set(key, uvar_string(vals), new_export);
             env_universal_barrier();
             if (old_export || new_export) {
-                vars_stack().mark_changed_exported();
+                vars_stack().mark_changed_exported(key, new_export);
             }
         }
     } else {
         // Determine the node.
-        bool has_changed_new = false;
-        env_node_t *preexisting_node = env_get_node(key);
+        const var_key_t var_key(key);
+        env_node_t *preexisting_node = env_get_node(var_key);
         bool preexisting_entry_exportv = false;
         if (preexisting_node != NULL) {
-            var_table_t::const_iterator result = preexisting_node->env.find(key);
-            assert(result != preexisting_node->env.end());
-            const var_entry_t &entry = result->second;
+            const scope_var_t *result = preexisting_node->find_entry(var_key);
+            assert(result != NULL);
+            const scope_var_t &entry = *result;
             if (entry.exportv) {
                 preexisting_entry_exportv = true;
-                has_changed_new = true;
             }
         }
 
@@ -767,8 +944,9 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
                     exportv = uvars()->get_export(key);
                 }
 
-                uvars()->set(key, val, exportv);
+                uvars()->set(key, uvar_string(vals), exportv);
                 env_universal_barrier();
+                vars_stack().mark_changed_exported(key, exportv);
 
                 done = 1;
 
@@ -779,24 +957,20 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
         }
 
         if (!done) {
-            // Set the entry in the node. Note that operator[] accesses the existing entry, or
+            // Set the entry in the node. Note that get_or_insert accesses the existing entry, or
             // creates a new one.
-            var_entry_t &entry = node->env[key];
-            if (entry.exportv) {
-                // This variable already existed, and was exported.
-                has_changed_new = true;
-            }
-            entry.val = val;
+            scoped_lock locker(env_lock);
+            scope_var_t &entry = node->env.get_or_insert(var_key);
+            entry.vals = std::make_shared<const wcstring_list_t>(std::move(vals));
             if (var_mode & ENV_EXPORT) {
                 // The new variable is exported.
                 entry.exportv = true;
                 node->exportv = true;
-                has_changed_new = true;
             } else {
                 entry.exportv = false;
             }
 
-            if (has_changed_old || has_changed_new) vars_stack().mark_changed_exported();
+            vars_stack().mark_changed_exported(key, entry.exportv);
         }
     }
 
@@ -817,17 +991,15 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
 /// Attempt to remove/free the specified key/value pair from the specified map.
 ///
 /// \return zero if the variable was not found, non-zero otherwise
-static bool try_remove(env_node_t *n, const wchar_t *key, int var_mode) {
+static bool try_remove(env_node_t *n, const var_key_t &key, int var_mode) {
     if (n == NULL) {
         return false;
     }
 
-    var_table_t::iterator result = n->env.find(key);
-    if (result != n->env.end()) {
-        if (result->second.exportv) {
-            vars_stack().mark_changed_exported();
-        }
-        n->env.erase(result);
+    const scope_var_t *result = n->find_entry(key);
+    if (result != NULL) {
+        vars_stack().mark_changed_exported(key.name);
+        n->env.erase(key);
         return true;
     }
 
@@ -857,7 +1029,7 @@ int env_remove(const wcstring &key, int var_mode) {
             first_node = vars_stack().global_env;
         }
 
-        if (try_remove(first_node, key.c_str(), var_mode)) {
+        if (try_remove(first_node, var_key_t(key), var_mode)) {
             event_t ev = event_t::variable_event(key);
             ev.arguments.push_back(L"VARIABLE");
             ev.arguments.push_back(L"ERASE");
@@ -880,7 +1052,7 @@ int env_remove(const wcstring &key, int var_mode) {
             event_fire(&ev);
         }
 
-        if (is_exported) vars_stack().mark_changed_exported();
+        if (is_exported) vars_stack().mark_changed_exported(key);
     }
 
     react_to_variable_change(key);
@@ -893,15 +1065,71 @@ const wchar_t *env_var_t::c_str(void) const {
     return wcstring::c_str();
 }
 
-env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode) {
+/// Search the local and global scopes selected by mode for the specified key. If it is found, set
+/// out_vals to its elements and return true.
+static bool env_get_scope_var(const wcstring &key, env_mode_flags_t mode, env_list_ref_t *out_vals) {
     const bool has_scope = mode & (ENV_LOCAL | ENV_GLOBAL | ENV_UNIVERSAL);
     const bool search_local = !has_scope || (mode & ENV_LOCAL);
     const bool search_global = !has_scope || (mode & ENV_GLOBAL);
+    if (!search_local && !search_global) return false;
+
+    const bool search_exported = (mode & ENV_EXPORT) || !(mode & ENV_UNEXPORT);
+    const bool search_unexported = (mode & ENV_UNEXPORT) || !(mode & ENV_EXPORT);
+
+    // Lock around a local region.
+    scoped_lock locker(env_lock);
+
+    env_node_t *env = search_local ? vars_stack().top.get() : vars_stack().global_env;
+    const var_key_t var_key(key);
+
+    while (env != NULL) {
+        const scope_var_t *entry = env->find_entry(var_key);
+        if (entry != NULL && (entry->exportv ? search_exported : search_unexported)) {
+            *out_vals = entry->vals;
+            return true;
+        }
+
+        if (has_scope) {
+            if (!search_global || env == vars_stack().global_env) break;
+            env = vars_stack().global_env;
+        } else {
+            env = vars_stack().next_scope_to_search(env);
+        }
+    }
+    return false;
+}
+
+/// Get the string value of the specified universal variable, if visible with the given mode.
+static env_var_t env_get_uvar(const wcstring &key, env_mode_flags_t mode) {
+    const bool has_scope = mode & (ENV_LOCAL | ENV_GLOBAL | ENV_UNIVERSAL);
     const bool search_universal = !has_scope || (mode & ENV_UNIVERSAL);
+    if (!search_universal) return env_var_t::missing_var();
 
     const bool search_exported = (mode & ENV_EXPORT) || !(mode & ENV_UNEXPORT);
     const bool search_unexported = (mode & ENV_UNEXPORT) || !(mode & ENV_EXPORT);
 
+    // Another hack. Only do a universal barrier on the main thread (since it can change variable
+    // values). Make sure we do this outside the env_lock because it may itself call env_get_string.
+    if (is_main_thread() && !get_proc_had_barrier()) {
+        set_proc_had_barrier(true);
+        env_universal_barrier();
+    }
+
+    if (uvars()) {
+        env_var_t env_var = uvars()->get(key);
+        if (env_var == ENV_NULL ||
+            !(uvars()->get_export(key) ? search_exported : search_unexported)) {
+            env_var = env_var_t::missing_var();
+        }
+        return env_var;
+    }
+    return env_var_t::missing_var();
+}
+
+env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode) {
+    const bool has_scope = mode & (ENV_LOCAL | ENV_GLOBAL | ENV_UNIVERSAL);
+    const bool search_global = !has_scope || (mode & ENV_GLOBAL);
+
     // Make the assumption that electric keys can't be shadowed elsewhere, since we currently block
     // that in env_set().
     if (is_electric(key)) {
@@ -929,48 +1157,42 @@ env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode) {
         DIE("unerecognized electric var name");
     }
 
-    if (search_local || search_global) {
-        /* Lock around a local region */
-        scoped_lock locker(env_lock);
-
-        env_node_t *env = search_local ? vars_stack().top.get() : vars_stack().global_env;
-
-        while (env != NULL) {
-            const var_entry_t *entry = env->find_entry(key);
-            if (entry != NULL && (entry->exportv ? search_exported : search_unexported)) {
-                if (entry->val == ENV_NULL) {
-                    return env_var_t::missing_var();
-                }
-                return entry->val;
-            }
-
-            if (has_scope) {
-                if (!search_global || env == vars_stack().global_env) break;
-                env = vars_stack().global_env;
-            } else {
-                env = vars_stack().next_scope_to_search(env);
-            }
-        }
-    }
-
-    if (!search_universal) return env_var_t::missing_var();
-
-    // Another hack. Only do a universal barrier on the main thread (since it can change variable
-    // values). Make sure we do this outside the env_lock because it may itself call env_get_string.
-    if (is_main_thread() && !get_proc_had_barrier()) {
-        set_proc_had_barrier(true);
-        env_universal_barrier();
+    env_list_ref_t vals;
+    if (env_get_scope_var(key, mode, &vals)) {
+        if (!vals || vals->empty()) return env_var_t::missing_var();
+        if (vals->size() == 1) return vals->front();
+        return join_variable_array(*vals);
     }
+    return env_get_uvar(key, mode);
+}
 
-    if (uvars()) {
-        env_var_t env_var = uvars()->get(key);
-        if (env_var == ENV_NULL ||
-            !(uvars()->get_export(key) ? search_exported : search_unexported)) {
-            env_var = env_var_t::missing_var();
+env_list_ref_t env_get_list(const wcstring &key, env_mode_flags_t mode, size_t max_count) {
+    const bool has_scope = mode & (ENV_LOCAL | ENV_GLOBAL | ENV_UNIVERSAL);
+    if (key == L"history" && (!has_scope || (mode & ENV_GLOBAL))) {
+        // Like env_get_string, only allow getting the history on the main thread. Only decode as
+        // many items as were asked for.
+        if (!is_main_thread()) return env_list_ref_t();
+        history_t *history = reader_get_history();
+        if (!history) {
+            history = &history_t::history_with_name(L"fish");
         }
-        return env_var;
-    }
-    return env_var_t::missing_var();
+        std::shared_ptr<wcstring_list_t> result = std::make_shared<wcstring_list_t>();
+        history->get_unique_items(result.get(), max_count);
+        if (result->empty()) return env_list_ref_t();
+        return result;
+    }
+
+    env_list_ref_t vals;
+    if (is_electric(key) || !env_get_scope_var(key, mode, &vals)) {
+        // Other electric variables and universal variables are stored as strings.
+        const env_var_t val = is_electric(key) ? env_get_string(key, mode) : env_get_uvar(key, mode);
+        if (val.missing()) return env_list_ref_t();
+        std::shared_ptr<wcstring_list_t> result = std::make_shared<wcstring_list_t>();
+        tokenize_variable_array(val, *result);
+        return result;
+    }
+    if (!vals || vals->empty()) return env_list_ref_t();
+    return vals;
 }
 
 bool env_exist(const wchar_t *key, env_mode_flags_t mode) {
@@ -995,15 +1217,15 @@ bool env_exist(const wchar_t *key, env_mode_flags_t mode) {
 
     if (test_local || test_global) {
         const env_node_t *env = test_local ? vars_stack().top.get() : vars_stack().global_env;
+        const var_key_t var_key(key);
         while (env != NULL) {
             if (env == vars_stack().global_env && !test_global) {
                 break;
             }
 
-            var_table_t::const_iterator result = env->env.find(key);
-            if (result != env->env.end()) {
-                const var_entry_t &res = result->second;
-                return res.exportv ? test_exported : test_unexported;
+            const scope_var_t *res = env->find_entry(var_key);
+            if (res != NULL) {
+                return res->exportv ? test_exported : test_unexported;
             }
             env = vars_stack().next_scope_to_search(env);
         }
@@ -1023,35 +1245,19 @@ bool env_exist(const wchar_t *key, env_mode_flags_t mode) {
     return 0;
 }
 
-/// Returns true if the specified scope or any non-shadowed non-global subscopes contain an exported
-/// variable.
-static bool local_scope_exports(const env_node_t *n) {
-    assert(n != NULL);
-    if (n == vars_stack().global_env) return false;
-
-    if (n->exportv) return true;
-
-    if (n->new_scope) return false;
-
-    return local_scope_exports(n->next.get());
-}
-
 void env_push(bool new_scope) { vars_stack().push(new_scope); }
 
 void env_pop() { vars_stack().pop(); }
 
 /// Function used with to insert keys of one table into a set::set<wcstring>.
-static void add_key_to_string_set(const var_table_t &envs, std::set<wcstring> *str_set,
+static void add_key_to_string_set(const var_scope_table_t &envs, std::set<wcstring> *str_set,
                                   bool show_exported, bool show_unexported) {
-    var_table_t::const_iterator iter;
-    for (iter = envs.begin(); iter != envs.end(); ++iter) {
-        const var_entry_t &e = iter->second;
-
+    envs.for_each([&](const wchar_t *name, const scope_var_t &e) {
         if ((e.exportv && show_exported) || (!e.exportv && show_unexported)) {
             // Insert this key.
-            str_set->insert(iter->first);
+            str_set->insert(name);
         }
-    }
+    });
 }
 
 wcstring_list_t env_get_names(int flags) {
@@ -1108,104 +1314,149 @@ static void get_exported(const env_node_t *n, std::map<wcstring, wcstring> *h) {
     else
         get_exported(n->next.get(), h);
 
-    var_table_t::const_iterator iter;
-    for (iter = n->env.begin(); iter != n->env.end(); ++iter) {
-        const wcstring &key = iter->first;
-        const var_entry_t &val_entry = iter->second;
-
-        if (val_entry.exportv && val_entry.val != ENV_NULL) {
+    n->env.for_each([&](const wchar_t *key, const scope_var_t &val_entry) {
+        if (val_entry.exportv && !val_entry.is_empty_array()) {
             // Export the variable. Don't use std::map::insert here, since we need to overwrite
             // existing values from previous scopes.
-            (*h)[key] = val_entry.val;
+            (*h)[key] = val_entry.as_string();
         } else {
             // We need to erase from the map if we are not exporting, since a lower scope may have
             // exported. See #2132.
             h->erase(key);
         }
+    });
+}
+
+/// Returns the string "key=value" used to export the given variable.
+static std::string export_string(const wcstring &key, const wcstring &val) {
+    std::string str = wcs2string(key);
+    std::string vs = wcs2string(val);
+
+    // Arrays in the value are ASCII record separator (0x1e) delimited. But some variables
+    // should have colons. Add those.
+    if (variable_is_colon_delimited_array(key)) {
+        // Replace ARRAY_SEP with colon.
+        std::replace(vs.begin(), vs.end(), (char)ARRAY_SEP, ':');
     }
+
+    str.reserve(str.size() + 1 + vs.size());
+    str.append("=");
+    str.append(vs);
+    return str;
 }
 
-// Given a map from key to value, add values to out of the form key=value.
-static void export_func(const std::map<wcstring, wcstring> &envs, std::vector<std::string> &out) {
-    out.reserve(out.size() + envs.size());
-    std::map<wcstring, wcstring>::const_iterator iter;
-    for (iter = envs.begin(); iter != envs.end(); ++iter) {
-        const wcstring &key = iter->first;
-        const std::string &ks = wcs2string(key);
-        std::string vs = wcs2string(iter->second);
-
-        // Arrays in the value are ASCII record separator (0x1e) delimited. But some variables
-        // should have colons. Add those.
-        if (variable_is_colon_delimited_array(key)) {
-            // Replace ARRAY_SEP with colon.
-            std::replace(vs.begin(), vs.end(), (char)ARRAY_SEP, ':');
-        }
+void var_stack_t::mark_changed_exported(const wcstring &key, bool is_exported) {
+    if (is_exported) {
+        this->exportable_keys.insert(key);
+    } else if (this->exportable_keys.find(key) == this->exportable_keys.end()) {
+        return;
+    }
+    this->changed_exported_keys.insert(key);
+}
 
-        // Put a string on the vector.
-        out.push_back(std::string());
-        std::string &str = out.back();
-        str.reserve(ks.size() + 1 + vs.size());
+void var_stack_t::mark_node_changed_exported(const env_node_t *node) {
+    if (this->exportable_keys.empty()) return;
+    node->env.for_each([&](const wchar_t *name, const scope_var_t &entry) {
+        UNUSED(entry);
+        this->mark_changed_exported(name);
+    });
+}
+
+bool var_stack_t::get_exported_value(const wcstring &key, wcstring *out_val) const {
+    // The topmost visible entry decides, even if it is not exported (see #2132), except that an
+    // exported universal variable is exported if no entry is. This matches
+    // update_export_array_if_necessary's full rebuild.
+    const var_key_t var_key(key);
+    for (const env_node_t *node = this->top.get(); node; node = next_scope_to_search(node)) {
+        const scope_var_t *entry = node->find_entry(var_key);
+        if (entry != NULL) {
+            if (!entry->exportv || entry->is_empty_array()) break;
+            out_val->assign(entry->as_string());
+            return true;
+        }
+    }
 
-        // Append our environment variable data to it.
-        str.append(ks);
-        str.append("=");
-        str.append(vs);
+    if (uvars() && uvars()->get_export(key)) {
+        const env_var_t val = uvars()->get(key);
+        if (!val.missing() && val != ENV_NULL) {
+            out_val->assign(val);
+            return true;
+        }
     }
+    return false;
 }
 
 void var_stack_t::update_export_array_if_necessary() {
-    if (!this->has_changed_exported) {
-        return;
-    }
-    std::map<wcstring, wcstring> vals;
+    if (this->has_changed_exported) {
+        std::map<wcstring, wcstring> vals;
 
-    debug(4, L"env_export_arr() recalc");
+        debug(4, L"env_export_arr() recalc");
 
-    get_exported(this->top.get(), &vals);
+        get_exported(this->top.get(), &vals);
 
-    if (uvars()) {
-        const wcstring_list_t uni = uvars()->get_names(true, false);
-        for (size_t i = 0; i < uni.size(); i++) {
-            const wcstring &key = uni.at(i);
-            const env_var_t val = uvars()->get(key);
-
-            if (!val.missing() && val != ENV_NULL) {
-                // Note that std::map::insert does NOT overwrite a value already in the map,
-                // which we depend on here.
-                vals.insert(std::pair<wcstring, wcstring>(key, val));
+        if (uvars()) {
+            const wcstring_list_t uni = uvars()->get_names(true, false);
+            for (size_t i = 0; i < uni.size(); i++) {
+                const wcstring &key = uni.at(i);
+                const env_var_t val = uvars()->get(key);
+
+                this->exportable_keys.insert(key);
+                if (!val.missing() && val != ENV_NULL) {
+                    // Note that std::map::insert does NOT overwrite a value already in the map,
+                    // which we depend on here.
+                    vals.insert(std::pair<wcstring, wcstring>(key, val));
+                }
+            }
+        }
+
+        this->export_strings.clear();
+        for (std::map<wcstring, wcstring>::const_iterator iter = vals.begin(); iter != vals.end();
+             ++iter) {
+            this->exportable_keys.insert(iter->first);
+            this->export_strings[iter->first] = export_string(iter->first, iter->second);
+        }
+        this->has_changed_exported = false;
+    } else if (!this->changed_exported_keys.empty()) {
+        // Only recompute the variables that may have changed.
+        debug(4, L"env_export_arr() update %lu", (unsigned long)changed_exported_keys.size());
+
+        wcstring val;
+        for (std::set<wcstring>::const_iterator iter = changed_exported_keys.begin();
+             iter != changed_exported_keys.end(); ++iter) {
+            const wcstring &key = *iter;
+            if (this->get_exported_value(key, &val)) {
+                this->export_strings[key] = export_string(key, val);
+            } else {
+                this->export_strings.erase(key);
             }
         }
+    } else if (!this->export_array.empty()) {
+        return;
     }
+    this->changed_exported_keys.clear();
 
-    std::vector<std::string> local_export_buffer;
-    export_func(vals, local_export_buffer);
-    export_array.set(local_export_buffer);
-    has_changed_exported = false;
+    this->export_array.clear();
+    this->export_array.reserve(this->export_strings.size() + 1);
+    for (std::map<wcstring, std::string>::const_iterator iter = export_strings.begin();
+         iter != export_strings.end(); ++iter) {
+        this->export_array.push_back(iter->second.c_str());
+    }
+    this->export_array.push_back(NULL);
 }
 
 const char *const *env_export_arr() {
     ASSERT_IS_MAIN_THREAD();
     ASSERT_IS_NOT_FORKED_CHILD();
     vars_stack().update_export_array_if_necessary();
-    return vars_stack().export_array.get();
+    return &vars_stack().export_array.at(0);
 }
 
 void env_set_argv(const wchar_t *const *argv) {
-    if (*argv) {
-        const wchar_t *const *arg;
-        wcstring sb;
-
-        for (arg = argv; *arg; arg++) {
-            if (arg != argv) {
-                sb.append(ARRAY_SEP_STR);
-            }
-            sb.append(*arg);
-        }
-
-        env_set(L"argv", sb.c_str(), ENV_LOCAL);
-    } else {
-        env_set(L"argv", 0, ENV_LOCAL);
+    wcstring_list_t vals;
+    for (const wchar_t *const *arg = argv; *arg; arg++) {
+        vals.push_back(*arg);
     }
+    env_set_list(L"argv", std::move(vals), ENV_LOCAL);
 }
 
 env_vars_snapshot_t::env_vars_snapshot_t(const wchar_t *const *keys) {
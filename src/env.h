@@ -53,6 +53,15 @@ void env_init(const struct config_paths_t *paths = NULL);
 
 int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t mode);
 
+/// Set the variable with the specified name to the given list of elements. An empty list makes a
+/// zero element array. Otherwise identical to env_set, but the elements are not joined with
+/// ARRAY_SEP and split again.
+int env_set_list(const wcstring &key, wcstring_list_t vals, env_mode_flags_t mode);
+
+/// The elements of an array variable. The list is shared with the variable and never modified, so
+/// holding a reference is cheap and remains valid after the variable changes.
+typedef std::shared_ptr<const wcstring_list_t> env_list_ref_t;
+
 class env_var_t : public wcstring {
    private:
     bool is_missing;
@@ -108,6 +117,17 @@ class env_var_t : public wcstring {
 /// \param mode An optional scope to search in. All scopes are searched if unset
 env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode = ENV_DEFAULT);
 
+/// Gets the elements of the variable with the specified name, or NULL if it does not exist or is
+/// an empty array. Unlike tokenizing the result of env_get_string, this does not copy or split the
+/// value of arrays stored in the local and global scopes.
+///
+/// \param key The name of the variable to get
+/// \param mode An optional scope to search in. All scopes are searched if unset
+/// \param max_count The number of leading elements the caller needs. Variables computed on demand,
+/// like $history, only compute that many; others return all their elements.
+env_list_ref_t env_get_list(const wcstring &key, env_mode_flags_t mode = ENV_DEFAULT,
+                            size_t max_count = (size_t)-1);
+
 /// Returns true if the specified key exists. This can't be reliably done using env_get, since
 /// env_get returns null for 0-element arrays.
 ///
@@ -174,6 +194,7 @@ class env_vars_snapshot_t {
 
 extern int g_fork_count;
 extern bool g_use_posix_spawn;
+extern bool g_use_vfork;
 
 /// A variable entry. Stores the value of a variable and whether it should be exported.
 struct var_entry_t {
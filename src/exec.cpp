@@ -7,9 +7,12 @@
 #include <assert.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <signal.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/select.h>
+#include <sys/wait.h>
 #include <unistd.h>
 #include <algorithm>
 #include <vector>
@@ -27,15 +30,20 @@
 #include "common.h"
 #include "env.h"
 #include "exec.h"
+#include "expand.h"
 #include "fallback.h"  // IWYU pragma: keep
 #include "function.h"
+#include "history.h"
 #include "io.h"
 #include "parse_tree.h"
 #include "parser.h"
+#include "parser_keywords.h"
+#include "path.h"
 #include "postfork.h"
 #include "proc.h"
 #include "reader.h"
 #include "signal.h"
+#include "tokenizer.h"
 #include "wutil.h"  // IWYU pragma: keep
 
 /// File descriptor redirection error message.
@@ -47,9 +55,19 @@
 /// File redirection error message.
 #define FILE_ERROR _(L"An error occurred while redirecting file '%s'")
 
+/// Noclobber redirection error message.
+#define NOCLOB_ERROR _(L"The file '%s' already exists")
+
 /// Base open mode to pass to calls to open.
 #define OPEN_MASK 0666
 
+/// The default for fish_read_limit: the most bytes of output a command substitution may produce.
+#define DEFAULT_READ_LIMIT (100 * 1024 * 1024)
+
+/// The most bytes of output a command substitution may produce, or 0 for no limit. Set by
+/// update_read_limit().
+static size_t s_read_limit = DEFAULT_READ_LIMIT;
+
 /// Called in a forked child.
 static void exec_write_and_exit(int fd, const char *buff, size_t count, int status) {
     if (write_loop(fd, buff, count) == -1) {
@@ -199,6 +217,32 @@ static void safe_launch_process(process_t *p, const char *actual_cmd, const char
     exit_without_destructors(STATUS_EXEC_FAIL);
 }
 
+#if FISH_USE_VFORK
+/// Launches an external command with vfork. Unlike fork, this doesn't copy the page tables of fish,
+/// which takes a while when fish uses a lot of memory. Unlike posix_spawn, the child can give the
+/// job the terminal and report failed redirections. Returns the pid of the child, or -1.
+static pid_t vfork_launch_process(job_t *j, process_t *p, const io_chain_t &io_chain,
+                                  const char *actual_cmd, const char *const *argv,
+                                  const char *const *envv) {
+    // The child runs on our memory until it execs, so it must not run our signal handlers.
+    sigset_t sigs, saved_sigs;
+    sigfillset(&sigs);
+    pthread_sigmask(SIG_BLOCK, &sigs, &saved_sigs);
+
+    g_fork_count++;
+    pid_t pid = vfork();
+    if (pid == 0) {
+        setup_vforked_child(j, p, io_chain);
+        safe_launch_process(p, actual_cmd, argv, envv);
+    }
+
+    int saved_errno = errno;
+    pthread_sigmask(SIG_SETMASK, &saved_sigs, NULL);
+    errno = saved_errno;
+    return pid;
+}
+#endif
+
 /// This function is similar to launch_process, except it is not called after a fork (i.e. it only
 /// calls exec) and therefore it can allocate memory.
 static void launch_process_nofork(process_t *p) {
@@ -307,7 +351,8 @@ static bool io_transmogrify(const io_chain_t &in_chain, io_chain_t *out_chain,
 /// \param node_offset the offset of the node to evalute, or NODE_OFFSET_INVALID
 /// \param block_type the type of block to push on evaluation
 /// \param ios the io redirections to be performed on this block
-static void internal_exec_helper(parser_t &parser, const wcstring &def, node_offset_t node_offset,
+static void internal_exec_helper(parser_t &parser, const wcstring &def,
+                                 const parsed_tree_ref_t &parsed_def, node_offset_t node_offset,
                                  enum block_type_t block_type, const io_chain_t &ios) {
     // If we have a valid node offset, then we must not have a string to execute.
     assert(node_offset == NODE_OFFSET_INVALID || def.empty());
@@ -324,7 +369,9 @@ static void internal_exec_helper(parser_t &parser, const wcstring &def, node_off
 
     signal_unblock();
 
-    if (node_offset == NODE_OFFSET_INVALID) {
+    if (node_offset == NODE_OFFSET_INVALID && parsed_def) {
+        parser.eval(def, morphed_chain, block_type, parsed_def);
+    } else if (node_offset == NODE_OFFSET_INVALID) {
         parser.eval(def, morphed_chain, block_type);
     } else {
         parser.eval_block_node(node_offset, morphed_chain, block_type);
@@ -337,6 +384,400 @@ static void internal_exec_helper(parser_t &parser, const wcstring &def, node_off
     job_reap(0);
 }
 
+/// Returns whether the builtin process p, which is not last in job j, can be run once the processes
+/// after it have been launched, so that its output streams into them as it is produced instead of
+/// being held until it finishes. Everything after it must be external, since nothing else can run
+/// while the builtin does. Nothing in the job may write into a buffer either: a buffer is only
+/// drained once the job is waited for, so a full one would stall the whole pipeline. The builtin
+/// itself must be one that can stream, see builtin_data_t.
+///
+/// Under job control the job's processes can be stopped without fish, e.g. with ^Z. A builtin
+/// that finds its output pipe full checks for that, see wait_for_job_pipe. Nothing can be done for
+/// a builtin waiting for input from a stopped process though, so under job control everything
+/// before it must be a builtin. Those have finished by the time it runs.
+static bool builtin_can_stream_output(const job_t *j, const process_t *p,
+                                      const io_chain_t &all_ios) {
+    if (p->is_last_in_job || !builtin_can_stream(p->argv0())) return false;
+
+    // Its stdout must be the pipe to the next process, not redirected elsewhere.
+    if (io_chain_get(p->io_chain(), STDOUT_FILENO)) return false;
+
+    for (size_t i = 0; i < all_ios.size(); i++) {
+        if (all_ios.at(i)->io_mode == IO_BUFFER) return false;
+    }
+
+    bool found = false;
+    for (const process_ptr_t &other : j->processes) {
+        if (other.get() == p) {
+            found = true;
+        } else if (found && other->type != EXTERNAL) {
+            return false;
+        } else if (!found && other->type != INTERNAL_BUILTIN && j->get_flag(JOB_CONTROL)) {
+            return false;
+        }
+    }
+    return found;
+}
+
+/// How long a builtin streaming its output waits for the pipe to the rest of the job to drain before
+/// checking whether the job has stopped.
+#define JOB_PIPE_STOP_CHECK_MSEC 20
+
+/// Waits until the pipe fd to the processes after a streaming builtin in job j can be written to.
+/// Returns false if a process of the job has stopped instead, or on errors. The builtin then stops
+/// streaming, so that fish can get on with handling the stop once it finishes.
+static bool wait_for_job_pipe(job_t *j, int fd) {
+    for (;;) {
+        // The last of the output is flushed with signals blocked, so don't count on SIGCHLD.
+        job_update_child_statuses();
+        for (const process_ptr_t &p : j->processes) {
+            if (p->stopped) {
+                debug(3, L"Job %d stopped, buffering the rest of the builtin output", j->job_id);
+                return false;
+            }
+        }
+
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        struct timeval timeout = {0, JOB_PIPE_STOP_CHECK_MSEC * 1000};
+        int ret = select(fd + 1, NULL, &fds, NULL, &timeout);
+        if (ret > 0) return true;
+        if (ret < 0 && errno != EINTR) {
+            wperror(L"select");
+            return false;
+        }
+    }
+}
+
+/// Runs the builtin process p. Its stdin is the read end of pipe_read if it is not first in the
+/// job, and otherwise is found in proc_io_chain. Output is left in \p streams. Returns false if
+/// stdin could not be opened.
+static bool exec_internal_builtin_proc(parser_t &parser, job_t *j, process_t *p,
+                                       const io_pipe_t *pipe_read, const io_chain_t &proc_io_chain,
+                                       io_streams_t &streams) {
+    int local_builtin_stdin = STDIN_FILENO;
+    bool close_stdin = false;
+
+    // If this is the first process, check the io redirections and see where we should be reading
+    // from.
+    if (p->is_first_in_job) {
+        const shared_ptr<const io_data_t> in = proc_io_chain.get_io_for_fd(STDIN_FILENO);
+
+        if (in) {
+            switch (in->io_mode) {
+                case IO_FD: {
+                    const io_fd_t *in_fd = static_cast<const io_fd_t *>(in.get());
+                    // Ignore user-supplied fd redirections from an fd other than the standard ones.
+                    // e.g. in source <&3 don't actually read from fd 3, which is internal to fish.
+                    // We still respect this redirection in that we pass it on as a block IO to the
+                    // code that source runs, and therefore this is not an error. Non-user supplied
+                    // fd redirections come about through transmogrification, and we need to respect
+                    // those here.
+                    if (!in_fd->user_supplied || (in_fd->old_fd >= 0 && in_fd->old_fd < 3)) {
+                        local_builtin_stdin = in_fd->old_fd;
+                    }
+                    break;
+                }
+                case IO_PIPE: {
+                    const io_pipe_t *in_pipe = static_cast<const io_pipe_t *>(in.get());
+                    local_builtin_stdin = in_pipe->pipe_fd[0];
+                    break;
+                }
+                case IO_FILE: {
+                    // Do not set CLO_EXEC because child needs access.
+                    const io_file_t *in_file = static_cast<const io_file_t *>(in.get());
+                    local_builtin_stdin = open(in_file->filename_cstr, in_file->flags, OPEN_MASK);
+                    if (local_builtin_stdin == -1) {
+                        debug(1, FILE_ERROR, in_file->filename_cstr);
+                        wperror(L"open");
+                    } else {
+                        close_stdin = true;
+                    }
+
+                    break;
+                }
+                case IO_CLOSE: {
+                    // FIXME: When requesting that stdin be closed, we really don't do anything. How
+                    // should this be handled?
+                    local_builtin_stdin = -1;
+
+                    break;
+                }
+                default: {
+                    local_builtin_stdin = -1;
+                    debug(1, _(L"Unknown input redirection type %d"), in->io_mode);
+                    break;
+                }
+            }
+        }
+    } else {
+        local_builtin_stdin = pipe_read->pipe_fd[0];
+    }
+
+    if (local_builtin_stdin == -1) return false;
+
+    // Determine if we have a "direct" redirection for stdin.
+    bool stdin_is_directly_redirected;
+    if (!p->is_first_in_job) {
+        // We must have a pipe
+        stdin_is_directly_redirected = true;
+    } else {
+        // We are not a pipe. Check if there is a redirection local to the process that's not
+        // IO_CLOSE.
+        const shared_ptr<const io_data_t> stdin_io = io_chain_get(p->io_chain(), STDIN_FILENO);
+        stdin_is_directly_redirected = stdin_io && stdin_io->io_mode != IO_CLOSE;
+    }
+
+    streams.stdin_fd = local_builtin_stdin;
+    streams.out_is_redirected = has_fd(proc_io_chain, STDOUT_FILENO);
+    streams.err_is_redirected = has_fd(proc_io_chain, STDERR_FILENO);
+    streams.stdin_is_directly_redirected = stdin_is_directly_redirected;
+    // A pipe from the previous process, or a file opened just for this builtin, is read by nothing
+    // else.
+    streams.stdin_is_exclusive = !p->is_first_in_job || close_stdin;
+    streams.io_chain = &proc_io_chain;
+
+    // Since this may be the foreground job, and since a builtin may execute another foreground job,
+    // we need to pretend to suspend this job while running the builtin, in order to avoid a
+    // situation where two jobs are running at once.
+    //
+    // The reason this is done here, and not by the relevant builtins, is that this way, the builtin
+    // does not need to know what job it is part of. It could probably figure that out by walking
+    // the job list, but it seems more robust to make exec handle things.
+    const int fg = j->get_flag(JOB_FOREGROUND);
+    j->set_flag(JOB_FOREGROUND, false);
+
+    signal_unblock();
+
+    p->status = builtin_run(parser, p->get_argv(), streams);
+
+    signal_block();
+
+    // Restore the fg flag, which is temporarily set to false during builtin execution so as not to
+    // confuse some job-handling builtins.
+    j->set_flag(JOB_FOREGROUND, fg);
+
+    // If stdin has been redirected, close the redirection stream.
+    if (close_stdin) {
+        exec_close(local_builtin_stdin);
+    }
+    return true;
+}
+
+/// Where output to an fd of a builtin ends up once its redirections are applied: an fd of fish
+/// itself, which is -1 if the fd was closed, or an internal buffer.
+struct builtin_output_target_t {
+    int fd;
+    io_buffer_t *buffer;
+
+    builtin_output_target_t(int f, io_buffer_t *b) : fd(f), buffer(b) {}
+};
+
+/// Works out where the stdout and stderr of a builtin go, by applying the redirections in io_chain
+/// in order, as a forked child would do with dup2, but without touching the fds of fish itself.
+/// Files are opened and added to opened_fds. Prints an error and returns false if a redirection
+/// fails.
+static bool resolve_builtin_output(const io_chain_t &io_chain, builtin_output_target_t *out_target,
+                                   builtin_output_target_t *err_target,
+                                   std::vector<int> *opened_fds) {
+    std::map<int, builtin_output_target_t> targets;
+    for (size_t idx = 0; idx < io_chain.size(); idx++) {
+        const io_data_t *io = io_chain.at(idx).get();
+        builtin_output_target_t target(-1, NULL);
+        switch (io->io_mode) {
+            case IO_CLOSE: {
+                break;
+            }
+            case IO_FILE: {
+                const io_file_t *io_file = static_cast<const io_file_t *>(io);
+                target.fd = open(io_file->filename_cstr, io_file->flags, OPEN_MASK);
+                if (target.fd < 0) {
+                    if ((io_file->flags & O_EXCL) && errno == EEXIST) {
+                        debug(1, NOCLOB_ERROR, io_file->filename_cstr);
+                    } else {
+                        debug(1, FILE_ERROR, io_file->filename_cstr);
+                        wperror(L"open");
+                    }
+                    return false;
+                }
+                opened_fds->push_back(target.fd);
+                break;
+            }
+            case IO_FD: {
+                int old_fd = static_cast<const io_fd_t *>(io)->old_fd;
+                std::map<int, builtin_output_target_t>::const_iterator iter = targets.find(old_fd);
+                if (iter != targets.end()) {
+                    target = iter->second;
+                } else if (fcntl(old_fd, F_GETFD) != -1) {
+                    target.fd = old_fd;
+                }
+                if (target.fd < 0 && target.buffer == NULL) {
+                    errno = EBADF;
+                    debug(1, FD_ERROR, io->fd);
+                    wperror(L"dup2");
+                    return false;
+                }
+                break;
+            }
+            case IO_BUFFER: {
+                target.buffer = static_cast<io_buffer_t *>(const_cast<io_data_t *>(io));
+                break;
+            }
+            case IO_PIPE: {
+                const io_pipe_t *io_pipe = static_cast<const io_pipe_t *>(io);
+                target.fd = io_pipe->pipe_fd[io_pipe->is_input ? 0 : 1];
+                break;
+            }
+        }
+        targets.erase(io->fd);
+        targets.insert(std::make_pair(io->fd, target));
+    }
+
+    std::map<int, builtin_output_target_t>::const_iterator iter = targets.find(STDOUT_FILENO);
+    if (iter != targets.end()) *out_target = iter->second;
+    iter = targets.find(STDERR_FILENO);
+    if (iter != targets.end()) *err_target = iter->second;
+    return true;
+}
+
+/// Output for the next process of a job that did not fit into the pipe to it.
+struct job_pipe_write_t {
+    int fd;
+    std::string data;
+};
+
+/// Writes out a job_pipe_write_t and closes its fd. This runs on a thread of its own rather than
+/// in the iothread pool: it blocks for as long as the reader takes to drain the pipe, which may be
+/// forever, and it must not keep other work off the pool or hold up iothread_drain_all.
+static void *job_pipe_writer(void *context) {
+    job_pipe_write_t *req = static_cast<job_pipe_write_t *>(context);
+    write_loop(req->fd, req->data.data(), req->data.size());
+    close(req->fd);
+    delete req;
+    return NULL;
+}
+
+/// Writes data to the pipe to the next process of the job, which may not have been launched yet.
+/// Whatever fits into the pipe is written right away; the rest is written by a detached thread,
+/// which takes over the fd. Returns true if it did.
+static bool write_to_job_pipe(int fd, const std::string &data) {
+    size_t written = 0;
+    bool pipe_is_full = false;
+    make_fd_nonblocking(fd);
+    while (written < data.size()) {
+        ssize_t amt = write(fd, data.data() + written, data.size() - written);
+        if (amt >= 0) {
+            written += amt;
+        } else if (errno == EAGAIN) {
+            pipe_is_full = true;
+            break;
+        } else if (errno != EINTR) {
+            break;
+        }
+    }
+    make_fd_blocking(fd);
+    if (!pipe_is_full) return false;  // all written, or the reader is gone
+
+    debug(3, L"Writing %lu bytes of builtin output in the background",
+          (unsigned long)(data.size() - written));
+    job_pipe_write_t *req = new job_pipe_write_t;
+    req->fd = fd;
+    req->data = data.substr(written);
+
+    // Like iothread_spawn, keep signals off the thread.
+    sigset_t new_set, saved_set;
+    sigfillset(&new_set);
+    VOMIT_ON_FAILURE(pthread_sigmask(SIG_BLOCK, &new_set, &saved_set));
+    pthread_t thread;
+    int err = pthread_create(&thread, NULL, job_pipe_writer, req);
+    if (err == 0) VOMIT_ON_FAILURE(pthread_detach(thread));
+    VOMIT_ON_FAILURE(pthread_sigmask(SIG_SETMASK, &saved_set, NULL));
+    if (err != 0) {
+        // Better to risk blocking until the reader is running than to lose the output.
+        debug(1, L"Could not start a thread to write builtin output, writing it directly");
+        write_loop(fd, req->data.data(), req->data.size());
+        delete req;
+        return false;
+    }
+    return true;
+}
+
+/// Writes the output a builtin process left in \p streams to where proc_io_chain says it goes.
+/// This is done by fish itself rather than by a forked child. \p job_pipe_fd is the write end of
+/// the pipe to the next process in the job, or -1. Output that doesn't fit into that pipe is
+/// written in the background, in which case the fd is taken over and set to -1.
+static void handle_builtin_output(job_t *j, process_t *p, io_chain_t &proc_io_chain,
+                                  const io_streams_t &streams, int *job_pipe_fd) {
+    const shared_ptr<io_data_t> stdout_io = proc_io_chain.get_io_for_fd(STDOUT_FILENO);
+    const shared_ptr<io_data_t> stderr_io = proc_io_chain.get_io_for_fd(STDERR_FILENO);
+
+    const wcstring &stdout_buffer = streams.out.buffer();
+    const wcstring &stderr_buffer = streams.err.buffer();
+
+    // If we are outputting to a file, we have to open it even if we have no output, so that the
+    // file is created or truncated. Does not apply to /dev/null.
+    bool must_open = redirection_is_to_real_file(stdout_io.get()) ||
+                     redirection_is_to_real_file(stderr_io.get());
+    if (!must_open && stdout_buffer.empty() && stderr_buffer.empty()) {
+        // The builtin produced no output, or has already streamed it out.
+        debug(3, L"No output for internal builtin '%ls'", p->argv0());
+    } else {
+        builtin_output_target_t out_target(STDOUT_FILENO, NULL);
+        builtin_output_target_t err_target(STDERR_FILENO, NULL);
+        std::vector<int> opened_fds;
+        if (!resolve_builtin_output(proc_io_chain, &out_target, &err_target, &opened_fds)) {
+            p->status = 1;
+        } else {
+            // These strings may contain embedded nulls, so don't treat them as C strings.
+            const std::string outbuff = wcs2string(stdout_buffer);
+            const std::string errbuff = wcs2string(stderr_buffer);
+
+            // Output bound for the next process is collected, so that it is written in order.
+            std::string job_pipe_data;
+            for (int i = 0; i < 2; i++) {
+                const builtin_output_target_t &target = i == 0 ? out_target : err_target;
+                const std::string &data = i == 0 ? outbuff : errbuff;
+                if (data.empty()) continue;
+                if (target.buffer != NULL) {
+                    target.buffer->out_buffer_append(data.data(), data.size());
+                } else if (target.fd >= 0 && target.fd == *job_pipe_fd) {
+                    job_pipe_data.append(data);
+                } else if (write_loop(target.fd, data.data(), data.size()) < 0 && i == 0 &&
+                           errno != EPIPE) {
+                    debug(0, L"Error while writing to stdout");
+                    wperror(L"write_loop");
+                }
+            }
+            if (!job_pipe_data.empty() && write_to_job_pipe(*job_pipe_fd, job_pipe_data)) {
+                *job_pipe_fd = -1;
+            }
+        }
+        io_cleanup_fds(opened_fds);
+    }
+
+    p->completed = 1;
+    if (p->is_last_in_job) {
+        debug(3, L"Set status of %ls to %d using short circuit", j->command_wcstr(), p->status);
+
+        int status = p->status;
+        proc_set_last_status(j->get_flag(JOB_NEGATE) ? (!status) : status);
+    }
+}
+
+/// A job's process group exists for as long as one of its processes is in it, even one that has
+/// exited but not been reaped. When a function or block in the pipeline waits for its own
+/// commands, it may reap the job's earlier processes, and the group goes away with them. Later
+/// processes can't join it then, so the next one starts a new group. Nothing is lost, since all
+/// processes of the old group are gone.
+static void forget_pgid_if_group_is_gone(job_t *j) {
+    if (j->get_flag(JOB_CONTROL) && j->pgid != 0 && killpg(j->pgid, 0) == -1 && errno == ESRCH) {
+        debug(3, L"Process group %d of job '%ls' is gone, starting a new one", j->pgid,
+              j->command_wcstr());
+        j->pgid = 0;
+    }
+}
+
 // Returns whether we can use posix spawn for a given process in a given job. Per
 // https://github.com/fish-shell/fish-shell/issues/364 , error handling for file redirections is too
 // difficult with posix_spawn, so in that case we use fork/exec.
@@ -371,8 +812,6 @@ void exec_job(parser_t &parser, job_t *j) {
     // Set to true if something goes wrong while exec:ing the job, in which case the cleanup code
     // will kick in.
     bool exec_error = false;
-    bool needs_keepalive = false;
-    process_t keepalive;
 
     CHECK(j, );
     CHECK_BLOCK();
@@ -398,6 +837,9 @@ void exec_job(parser_t &parser, job_t *j) {
     }
 
     if (j->processes.front()->type == INTERNAL_EXEC) {
+        // We won't get to save history on the way out, so do it now.
+        history_destroy();
+
         // Do a regular launch -  but without forking first...
         signal_block();
 
@@ -448,38 +890,6 @@ void exec_job(parser_t &parser, job_t *j) {
 
     signal_block();
 
-    // See if we need to create a group keepalive process. This is a process that we create to make
-    // sure that the process group doesn't die accidentally, and is often needed when a
-    // builtin/block/function is inside a pipeline, since that usually means we have to wait for one
-    // program to exit before continuing in the pipeline, causing the group leader to exit.
-    if (j->get_flag(JOB_CONTROL) && !exec_error) {
-        for (const process_ptr_t &p : j->processes) {
-            if (p->type != EXTERNAL) {
-                if (!p->is_last_in_job || !p->is_first_in_job) {
-                    needs_keepalive = true;
-                    break;
-                }
-            }
-        }
-    }
-
-    if (needs_keepalive) {
-        // Call fork. No need to wait for threads since our use is confined and simple.
-        keepalive.pid = execute_fork(false);
-        if (keepalive.pid == 0) {
-            // Child
-            keepalive.pid = getpid();
-            set_child_group(j, &keepalive, 1);
-            pause();
-            exit_without_destructors(0);
-        } else {
-            // Parent
-            debug(2, L"Fork #%d, pid %d: keepalive fork for '%ls'", g_fork_count, keepalive.pid,
-                  j->command_wcstr());
-            set_child_group(j, &keepalive, 0);
-        }
-    }
-
     // This loop loops over every process_t in the job, starting it as appropriate. This turns out
     // to be rather complex, since a process_t can be one of many rather different things.
     //
@@ -494,6 +904,14 @@ void exec_job(parser_t &parser, job_t *j) {
     // We are careful to set these to -1 when closed, so if we exit the loop abruptly, we can still
     // close them.
     int pipe_current_read = -1, pipe_current_write = -1, pipe_next_read = -1;
+
+    // A builtin that is run after the rest of the job has been launched, along with the IO chain
+    // and the pipe fds it was given. See builtin_can_stream_output.
+    process_t *deferred_builtin = NULL;
+    io_chain_t deferred_io_chain;
+    shared_ptr<io_pipe_t> deferred_pipe_read, deferred_pipe_write;
+    int deferred_read = -1, deferred_write = -1;
+
     for (std::unique_ptr<process_t> &unique_p : j->processes) {
         if (exec_error) {
             break;
@@ -611,6 +1029,20 @@ void exec_job(parser_t &parser, job_t *j) {
             pipe_next_read = local_pipe[0];
         }
 
+        if (p->type == INTERNAL_BUILTIN && builtin_can_stream_output(j, p, all_ios)) {
+            // Keep the builtin's pipes open until it runs.
+            assert(deferred_builtin == NULL);
+            deferred_builtin = p;
+            deferred_io_chain = process_net_io_chain;
+            deferred_pipe_read = pipe_read;
+            deferred_pipe_write = pipe_write;
+            deferred_read = pipe_current_read;
+            deferred_write = pipe_current_write;
+            pipe_current_read = -1;
+            pipe_current_write = -1;
+            continue;
+        }
+
         // This is the IO buffer we use for storing the output of a block or function when it is in
         // a pipeline.
         shared_ptr<io_buffer_t> block_output_io_buffer;
@@ -626,6 +1058,7 @@ void exec_job(parser_t &parser, job_t *j) {
                 const wcstring func_name = p->argv0();
                 wcstring def;
                 bool function_exists = function_get_definition(func_name, &def);
+                const parsed_tree_ref_t parsed_def = function_get_parsed_definition(func_name);
                 bool shadow_scope = function_get_shadow_scope(func_name);
                 const std::map<wcstring, env_var_t> inherit_vars =
                     function_get_inherit_vars(func_name);
@@ -664,7 +1097,7 @@ void exec_job(parser_t &parser, job_t *j) {
                 }
 
                 if (!exec_error) {
-                    internal_exec_helper(parser, def, NODE_OFFSET_INVALID, TOP,
+                    internal_exec_helper(parser, def, parsed_def, NODE_OFFSET_INVALID, TOP,
                                          process_net_io_chain);
                 }
 
@@ -689,127 +1122,17 @@ void exec_job(parser_t &parser, job_t *j) {
                 }
 
                 if (!exec_error) {
-                    internal_exec_helper(parser, wcstring(), p->internal_block_node, TOP,
-                                         process_net_io_chain);
+                    internal_exec_helper(parser, wcstring(), parsed_tree_ref_t(),
+                                         p->internal_block_node, TOP, process_net_io_chain);
                 }
                 break;
             }
 
             case INTERNAL_BUILTIN: {
-                int local_builtin_stdin = STDIN_FILENO;
-                bool close_stdin = false;
-
-                // If this is the first process, check the io redirections and see where we should
-                // be reading from.
-                if (p->is_first_in_job) {
-                    const shared_ptr<const io_data_t> in =
-                        process_net_io_chain.get_io_for_fd(STDIN_FILENO);
-
-                    if (in) {
-                        switch (in->io_mode) {
-                            case IO_FD: {
-                                const io_fd_t *in_fd = static_cast<const io_fd_t *>(in.get());
-                                // Ignore user-supplied fd redirections from an fd other than the
-                                // standard ones. e.g. in source <&3 don't actually read from fd 3,
-                                // which is internal to fish. We still respect this redirection in
-                                // that we pass it on as a block IO to the code that source runs,
-                                // and therefore this is not an error. Non-user supplied fd
-                                // redirections come about through transmogrification, and we need
-                                // to respect those here.
-                                if (!in_fd->user_supplied ||
-                                    (in_fd->old_fd >= 0 && in_fd->old_fd < 3)) {
-                                    local_builtin_stdin = in_fd->old_fd;
-                                }
-                                break;
-                            }
-                            case IO_PIPE: {
-                                const io_pipe_t *in_pipe = static_cast<const io_pipe_t *>(in.get());
-                                local_builtin_stdin = in_pipe->pipe_fd[0];
-                                break;
-                            }
-                            case IO_FILE: {
-                                // Do not set CLO_EXEC because child needs access.
-                                const io_file_t *in_file = static_cast<const io_file_t *>(in.get());
-                                local_builtin_stdin =
-                                    open(in_file->filename_cstr, in_file->flags, OPEN_MASK);
-                                if (local_builtin_stdin == -1) {
-                                    debug(1, FILE_ERROR, in_file->filename_cstr);
-                                    wperror(L"open");
-                                } else {
-                                    close_stdin = true;
-                                }
-
-                                break;
-                            }
-                            case IO_CLOSE: {
-                                // FIXME: When requesting that stdin be closed, we really don't do
-                                // anything. How should this be handled?
-                                local_builtin_stdin = -1;
-
-                                break;
-                            }
-                            default: {
-                                local_builtin_stdin = -1;
-                                debug(1, _(L"Unknown input redirection type %d"), in->io_mode);
-                                break;
-                            }
-                        }
-                    }
-                } else {
-                    local_builtin_stdin = pipe_read->pipe_fd[0];
-                }
-
-                if (local_builtin_stdin == -1) {
+                builtin_io_streams.reset(new io_streams_t());
+                if (!exec_internal_builtin_proc(parser, j, p, pipe_read.get(),
+                                                process_net_io_chain, *builtin_io_streams)) {
                     exec_error = true;
-                    break;
-                } else {
-                    // Determine if we have a "direct" redirection for stdin.
-                    bool stdin_is_directly_redirected;
-                    if (!p->is_first_in_job) {
-                        // We must have a pipe
-                        stdin_is_directly_redirected = true;
-                    } else {
-                        // We are not a pipe. Check if there is a redirection local to the process
-                        // that's not IO_CLOSE.
-                        const shared_ptr<const io_data_t> stdin_io =
-                            io_chain_get(p->io_chain(), STDIN_FILENO);
-                        stdin_is_directly_redirected = stdin_io && stdin_io->io_mode != IO_CLOSE;
-                    }
-
-                    builtin_io_streams.reset(new io_streams_t());
-                    builtin_io_streams->stdin_fd = local_builtin_stdin;
-                    builtin_io_streams->out_is_redirected =
-                        has_fd(process_net_io_chain, STDOUT_FILENO);
-                    builtin_io_streams->err_is_redirected =
-                        has_fd(process_net_io_chain, STDERR_FILENO);
-                    builtin_io_streams->stdin_is_directly_redirected = stdin_is_directly_redirected;
-                    builtin_io_streams->io_chain = &process_net_io_chain;
-
-                    // Since this may be the foreground job, and since a builtin may execute another
-                    // foreground job, we need to pretend to suspend this job while running the
-                    // builtin, in order to avoid a situation where two jobs are running at once.
-                    //
-                    // The reason this is done here, and not by the relevant builtins, is that this
-                    // way, the builtin does not need to know what job it is part of. It could
-                    // probably figure that out by walking the job list, but it seems more robust to
-                    // make exec handle things.
-                    const int fg = j->get_flag(JOB_FOREGROUND);
-                    j->set_flag(JOB_FOREGROUND, false);
-
-                    signal_unblock();
-
-                    p->status = builtin_run(parser, p->get_argv(), *builtin_io_streams);
-
-                    signal_block();
-
-                    // Restore the fg flag, which is temporarily set to false during builtin
-                    // execution so as not to confuse some job-handling builtins.
-                    j->set_flag(JOB_FOREGROUND, fg);
-                }
-
-                // If stdin has been redirected, close the redirection stream.
-                if (close_stdin) {
-                    exec_close(local_builtin_stdin);
                 }
                 break;
             }
@@ -828,6 +1151,7 @@ void exec_job(parser_t &parser, job_t *j) {
             break;
         }
 
+        forget_pgid_if_group_is_gone(j);
         switch (p->type) {
             case INTERNAL_BLOCK_NODE:
             case INTERNAL_FUNCTION: {
@@ -885,111 +1209,8 @@ void exec_job(parser_t &parser, job_t *j) {
             }
 
             case INTERNAL_BUILTIN: {
-                // Handle output from builtin commands. In the general case, this means forking of a
-                // worker process, that will write out the contents of the stdout and stderr buffers
-                // to the correct file descriptor. Since forking is expensive, fish tries to avoid
-                // it when possible.
-                bool fork_was_skipped = false;
-
-                const shared_ptr<io_data_t> stdout_io =
-                    process_net_io_chain.get_io_for_fd(STDOUT_FILENO);
-                const shared_ptr<io_data_t> stderr_io =
-                    process_net_io_chain.get_io_for_fd(STDERR_FILENO);
-
-                assert(builtin_io_streams.get() != NULL);
-                const wcstring &stdout_buffer = builtin_io_streams->out.buffer();
-                const wcstring &stderr_buffer = builtin_io_streams->err.buffer();
-
-                // If we are outputting to a file, we have to actually do it, even if we have no
-                // output, so that we can truncate the file. Does not apply to /dev/null.
-                bool must_fork = redirection_is_to_real_file(stdout_io.get()) ||
-                                 redirection_is_to_real_file(stderr_io.get());
-                if (!must_fork && p->is_last_in_job) {
-                    const bool stdout_is_to_buffer = stdout_io && stdout_io->io_mode == IO_BUFFER;
-                    const bool no_stdout_output = stdout_buffer.empty();
-                    const bool no_stderr_output = stderr_buffer.empty();
-
-                    if (no_stdout_output && no_stderr_output) {
-                        // The builtin produced no output and is not inside of a pipeline. No
-                        // need to fork or even output anything.
-                        debug(3, L"Skipping fork: no output for internal builtin '%ls'",
-                              p->argv0());
-                        fork_was_skipped = true;
-                    } else if (no_stderr_output && stdout_is_to_buffer) {
-                        // The builtin produced no stderr, and its stdout is going to an
-                        // internal buffer. There is no need to fork. This helps out the
-                        // performance quite a bit in complex completion code.
-                        debug(3, L"Skipping fork: buffered output for internal builtin '%ls'",
-                              p->argv0());
-
-                        io_buffer_t *io_buffer = static_cast<io_buffer_t *>(stdout_io.get());
-                        const std::string res = wcs2string(builtin_io_streams->out.buffer());
-
-                        io_buffer->out_buffer_append(res.data(), res.size());
-                        fork_was_skipped = true;
-                    } else if (stdout_io.get() == NULL && stderr_io.get() == NULL) {
-                        // We are writing to normal stdout and stderr. Just do it - no need to
-                        // fork.
-                        debug(3, L"Skipping fork: ordinary output for internal builtin '%ls'",
-                              p->argv0());
-                        const std::string outbuff = wcs2string(stdout_buffer);
-                        const std::string errbuff = wcs2string(stderr_buffer);
-                        bool builtin_io_done = do_builtin_io(outbuff.data(), outbuff.size(),
-                                                             errbuff.data(), errbuff.size());
-                        if (!builtin_io_done && errno != EPIPE) {
-                            redirect_tty_output();  // workaround glibc bug
-                            debug(0, "!builtin_io_done and errno != EPIPE");
-                            show_stackframe(L'E');
-                        }
-                        fork_was_skipped = true;
-                    }
-                }
-
-                if (fork_was_skipped) {
-                    p->completed = 1;
-                    if (p->is_last_in_job) {
-                        debug(3, L"Set status of %ls to %d using short circuit", j->command_wcstr(),
-                              p->status);
-
-                        int status = p->status;
-                        proc_set_last_status(j->get_flag(JOB_NEGATE) ? (!status) : status);
-                    }
-                } else {
-                    // Ok, unfortunately, we have to do a real fork. Bummer. We work hard to make
-                    // sure we don't have to wait for all our threads to exit, by arranging things
-                    // so that we don't have to allocate memory or do anything except system calls
-                    // in the child.
-                    //
-                    // These strings may contain embedded nulls, so don't treat them as C strings.
-                    const std::string outbuff_str = wcs2string(stdout_buffer);
-                    const char *outbuff = outbuff_str.data();
-                    size_t outbuff_len = outbuff_str.size();
-
-                    const std::string errbuff_str = wcs2string(stderr_buffer);
-                    const char *errbuff = errbuff_str.data();
-                    size_t errbuff_len = errbuff_str.size();
-
-                    fflush(stdout);
-                    fflush(stderr);
-                    pid = execute_fork(false);
-                    if (pid == 0) {
-                        // This is the child process. Setup redirections, print correct output to
-                        // stdout and stderr, and then exit.
-                        p->pid = getpid();
-                        setup_child_process(j, p, process_net_io_chain);
-                        do_builtin_io(outbuff, outbuff_len, errbuff, errbuff_len);
-                        exit_without_destructors(p->status);
-                    } else {
-                        // This is the parent process. Store away information on the child, and
-                        // possibly give it control over the terminal.
-                        debug(2, L"Fork #%d, pid %d: internal builtin for '%ls'", g_fork_count, pid,
-                              p->argv0());
-                        p->pid = pid;
-
-                        set_child_group(j, p, 0);
-                    }
-                }
-
+                handle_builtin_output(j, p, process_net_io_chain, *builtin_io_streams,
+                                      &pipe_current_write);
                 break;
             }
 
@@ -1055,6 +1276,19 @@ void exec_job(parser_t &parser, job_t *j) {
                         exec_error = true;
                     }
                 } else
+#endif
+#if FISH_USE_VFORK
+                // Use vfork where posix_spawn can't be used, e.g. for foreground jobs.
+                if (g_use_vfork) {
+                    pid = vfork_launch_process(j, p, process_net_io_chain, actual_cmd, argv, envv);
+                    debug(2, L"Fork #%d, pid %d: vfork external command '%s' from '%ls'",
+                          g_fork_count, pid, actual_cmd, file ? file : L"<no file>");
+                    if (pid < 0) {
+                        wperror(L"vfork");
+                        job_mark_process_as_failed(j, p);
+                        exec_error = true;
+                    }
+                } else
 #endif
                 {
                     pid = execute_fork(false);
@@ -1107,9 +1341,28 @@ void exec_job(parser_t &parser, job_t *j) {
     if (pipe_current_write >= 0) exec_close(pipe_current_write);
     if (pipe_next_read >= 0) exec_close(pipe_next_read);
 
-    // The keepalive process is no longer needed, so we terminate it with extreme prejudice.
-    if (needs_keepalive) {
-        kill(keepalive.pid, SIGKILL);
+    if (deferred_builtin != NULL) {
+        // The processes reading the builtin's output are running, so it can write to them directly.
+        // If they go away, the write fails and the builtin is expected to stop.
+        // The read end of its output pipe was handed to the next process and closed since.
+        deferred_pipe_write->pipe_fd[0] = -1;
+        if (!exec_error) {
+            io_streams_t streams;
+            make_fd_nonblocking(deferred_write);
+            streams.out.stream_to_fd(deferred_write,
+                                     [j](int fd) { return wait_for_job_pipe(j, fd); });
+            if (exec_internal_builtin_proc(parser, j, deferred_builtin, deferred_pipe_read.get(),
+                                           deferred_io_chain, streams)) {
+                streams.out.flush();
+                forget_pgid_if_group_is_gone(j);
+                handle_builtin_output(j, deferred_builtin, deferred_io_chain, streams,
+                                      &deferred_write);
+            } else {
+                exec_error = true;
+            }
+        }
+        if (deferred_read >= 0) exec_close(deferred_read);
+        if (deferred_write >= 0) exec_close(deferred_write);
     }
 
     signal_unblock();
@@ -1130,7 +1383,7 @@ void exec_job(parser_t &parser, job_t *j) {
 }
 
 static int exec_subshell_internal(const wcstring &cmd, wcstring_list_t *lst,
-                                  bool apply_exit_status) {
+                                  bool apply_exit_status, bool *out_discarded) {
     ASSERT_IS_MAIN_THREAD();
     int prev_subshell = is_subshell;
     const int prev_status = proc_get_last_status();
@@ -1143,10 +1396,13 @@ static int exec_subshell_internal(const wcstring &cmd, wcstring_list_t *lst,
 
     is_subshell = 1;
     int subcommand_status = -1;  // assume the worst
+    if (out_discarded != NULL) *out_discarded = false;
 
     // IO buffer creation may fail (e.g. if we have too many open files to make a pipe), so this may
-    // be null.
-    const shared_ptr<io_buffer_t> io_buffer(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
+    // be null. The buffer splits and decodes the output as it arrives, so we never hold all of the
+    // raw output and its decoded copy at once.
+    const shared_ptr<io_buffer_t> io_buffer(
+        io_buffer_t::create_for_cmdsubst(split_output, s_read_limit));
     if (io_buffer.get() != NULL) {
         parser_t &parser = parser_t::principal_parser();
         if (parser.eval(cmd, io_chain_t(io_buffer), SUBST) == 0) {
@@ -1154,54 +1410,222 @@ static int exec_subshell_internal(const wcstring &cmd, wcstring_list_t *lst,
         }
 
         io_buffer->read();
+
+        wcstring_list_t lines;
+        if (!io_buffer->take_lines(&lines)) {
+            subcommand_status = STATUS_READ_TOO_MUCH;
+            if (out_discarded != NULL) *out_discarded = true;
+        } else if (lst != NULL) {
+            if (lst->empty()) {
+                lst->swap(lines);
+            } else {
+                lst->insert(lst->end(), lines.begin(), lines.end());
+            }
+        }
     }
 
     // If the caller asked us to preserve the exit status, restore the old status. Otherwise set the
     // status of the subcommand.
     proc_set_last_status(apply_exit_status ? subcommand_status : prev_status);
     is_subshell = prev_subshell;
+    return subcommand_status;
+}
 
-    if (lst == NULL || io_buffer.get() == NULL) {
-        return subcommand_status;
-    }
+int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool apply_exit_status,
+                  bool *out_discarded) {
+    ASSERT_IS_MAIN_THREAD();
+    return exec_subshell_internal(cmd, &outputs, apply_exit_status, out_discarded);
+}
 
-    const char *begin = io_buffer->out_buffer_ptr();
-    const char *end = begin + io_buffer->out_buffer_size();
-    if (split_output) {
-        const char *cursor = begin;
-        while (cursor < end) {
-            // Look for the next separator.
-            const char *stop = (const char *)memchr(cursor, '\n', end - cursor);
-            const bool hit_separator = (stop != NULL);
-            if (!hit_separator) {
-                // If it's not found, just use the end.
-                stop = end;
-            }
-            // Stop now points at the first character we do not want to copy.
-            const wcstring wc = str2wcstring(cursor, stop - cursor);
-            lst->push_back(wc);
+int exec_subshell(const wcstring &cmd, bool apply_exit_status) {
+    ASSERT_IS_MAIN_THREAD();
+    return exec_subshell_internal(cmd, NULL, apply_exit_status, NULL);
+}
 
-            // If we hit a separator, skip over it; otherwise we're at the end.
-            cursor = stop + (hit_separator ? 1 : 0);
+/// If the command substitution cmd runs nothing but a single external command, whose arguments
+/// expand without variables, jobs or further command substitutions, stores the path of the command
+/// and its expanded arguments and returns true. Such a command neither depends on nor changes the
+/// state of the shell.
+static bool subshell_is_external_only(const wcstring &cmd, wcstring *out_path,
+                                      wcstring_list_t *out_argv) {
+    wcstring_list_t tokens;
+    tokenizer_t tok(cmd.c_str(), 0);
+    tok_t token;
+    while (tok.next(&token)) {
+        if (token.type != TOK_STRING) return false;
+        if (token.text.find_first_of(L"$(") != wcstring::npos || token.text.at(0) == L'%') {
+            return false;
         }
-    } else {
-        // We're not splitting output, but we still want to trim off a trailing newline.
-        if (end != begin && end[-1] == '\n') {
-            --end;
+        tokens.push_back(token.text);
+    }
+    if (tokens.empty()) return false;
+
+    wcstring command = tokens.at(0);
+    if (!expand_one(command, EXPAND_SKIP_CMDSUBST | EXPAND_SKIP_WILDCARDS, NULL) ||
+        parser_keywords_is_reserved(command) || builtin_exists(command) ||
+        function_exists_no_autoload(command, env_vars_snapshot_t::current()) ||
+        !path_get_path(command, out_path)) {
+        return false;
+    }
+
+    out_argv->push_back(command);
+    std::vector<completion_t> expanded;
+    for (size_t i = 1; i < tokens.size(); i++) {
+        expanded.clear();
+        int expand_ret =
+            expand_string(tokens.at(i), &expanded, EXPAND_SKIP_CMDSUBST | EXPAND_NO_DESCRIPTIONS,
+                          NULL);
+        if (expand_ret != EXPAND_OK && expand_ret != EXPAND_WILDCARD_MATCH) return false;
+        for (size_t j = 0; j < expanded.size(); j++) {
+            out_argv->push_back(expanded.at(j).completion);
         }
-        const wcstring wc = str2wcstring(begin, end - begin);
-        lst->push_back(wc);
     }
+    return true;
+}
 
-    return subcommand_status;
+/// Launches an external command for exec_subshells_concurrently, with its stdout going to out_fd.
+/// Returns the pid of the child, or -1.
+static pid_t launch_subshell_command(const char *actual_cmd, const char *const *argv,
+                                     const char *const *envv, int out_fd) {
+    sigset_t sigs, saved_sigs;
+    sigfillset(&sigs);
+    pthread_sigmask(SIG_BLOCK, &sigs, &saved_sigs);
+
+#if FISH_USE_VFORK
+    g_fork_count++;
+    pid_t pid = vfork();
+#else
+    pid_t pid = execute_fork(false);
+#endif
+    if (pid == 0) {
+        if (dup2(out_fd, STDOUT_FILENO) == -1) {
+            debug_safe(1, "An error occurred while setting up pipe");
+            safe_perror("dup2");
+            exit_without_destructors(1);
+        }
+        signal_reset_handlers();
+        sigemptyset(&sigs);
+        sigprocmask(SIG_SETMASK, &sigs, NULL);
+        safe_launch_process(NULL, actual_cmd, argv, envv);
+    }
+
+    int saved_errno = errno;
+    pthread_sigmask(SIG_SETMASK, &saved_sigs, NULL);
+    errno = saved_errno;
+    return pid;
 }
 
-int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool apply_exit_status) {
+void exec_subshells_concurrently(const wcstring_list_t &cmds,
+                                 std::vector<subshell_result_t> *out_results) {
     ASSERT_IS_MAIN_THREAD();
-    return exec_subshell_internal(cmd, &outputs, apply_exit_status);
+    // Only the leading commands that are independent of the shell can run early. A later one might
+    // depend on what an earlier one that uses the shell did, e.g. with cd or set.
+    std::vector<wcstring> paths;
+    std::vector<wcstring_list_t> argvs;
+    for (size_t i = 0; i < cmds.size(); i++) {
+        wcstring path;
+        wcstring_list_t argv;
+        if (!subshell_is_external_only(cmds.at(i), &path, &argv)) break;
+        paths.push_back(path);
+        argvs.push_back(argv);
+    }
+    if (paths.size() < 2) return;  // nothing would run concurrently
+
+    const env_var_t ifs = env_get_string(L"IFS");
+    const bool split_output = !ifs.missing_or_empty();
+    if (!get_proc_had_barrier()) {
+        set_proc_had_barrier(true);
+        env_universal_barrier();
+    }
+    const char *const *envv = env_export_arr();
+
+    std::vector<shared_ptr<io_buffer_t> > buffers;
+    std::vector<pid_t> pids;
+    for (size_t i = 0; i < paths.size(); i++) {
+        const shared_ptr<io_buffer_t> buffer(
+            io_buffer_t::create_for_cmdsubst(split_output, s_read_limit));
+        if (buffer.get() == NULL) break;
+
+        null_terminated_array_t<wchar_t> wide_argv(argvs.at(i));
+        null_terminated_array_t<char> argv;
+        convert_wide_array_to_narrow(wide_argv, &argv);
+        const std::string actual_cmd = wcs2string(paths.at(i));
+        pid_t pid = launch_subshell_command(actual_cmd.c_str(), argv.get(), envv,
+                                            buffer->pipe_fd[1]);
+        exec_close(buffer->pipe_fd[1]);
+        buffer->pipe_fd[1] = -1;
+        if (pid < 0) {
+            wperror(L"fork");
+            break;
+        }
+        debug(2, L"Fork #%d, pid %d: concurrent command substitution '%ls'", g_fork_count, pid,
+              cmds.at(i).c_str());
+        buffers.push_back(buffer);
+        pids.push_back(pid);
+    }
+
+    // Read the output of all commands as it arrives, so that none of them stalls on a full pipe.
+    std::vector<bool> at_eof(buffers.size(), false);
+    size_t open_count = buffers.size();
+    while (open_count > 0) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        int max_fd = -1;
+        for (size_t i = 0; i < buffers.size(); i++) {
+            if (at_eof.at(i)) continue;
+            FD_SET(buffers.at(i)->pipe_fd[0], &fds);
+            max_fd = std::max(max_fd, buffers.at(i)->pipe_fd[0]);
+        }
+        if (select(max_fd + 1, &fds, NULL, NULL, NULL) == -1) {
+            if (errno == EINTR) continue;
+            // We can't read their output anymore, so kill the commands that might still write it
+            // rather than waiting for them forever.
+            wperror(L"select");
+            for (size_t i = 0; i < buffers.size(); i++) {
+                if (!at_eof.at(i)) kill(pids.at(i), SIGKILL);
+            }
+            break;
+        }
+        for (size_t i = 0; i < buffers.size(); i++) {
+            if (at_eof.at(i) || !FD_ISSET(buffers.at(i)->pipe_fd[0], &fds)) continue;
+            char b[4096];
+            ssize_t amt = read(buffers.at(i)->pipe_fd[0], b, sizeof b);
+            if (amt > 0) {
+                buffers.at(i)->out_buffer_append(b, amt);
+            } else if (amt == 0 || (errno != EAGAIN && errno != EINTR)) {
+                at_eof.at(i) = true;
+                open_count--;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < pids.size(); i++) {
+        int status = 0;
+        while (waitpid(pids.at(i), &status, 0) == -1 && errno == EINTR) {
+        }
+
+        subshell_result_t result;
+        result.cmd = cmds.at(i);
+        result.status = proc_format_status(status);
+        result.discarded = !buffers.at(i)->take_lines(&result.outputs);
+        if (result.discarded) result.status = STATUS_READ_TOO_MUCH;
+        out_results->push_back(result);
+    }
 }
 
-int exec_subshell(const wcstring &cmd, bool apply_exit_status) {
-    ASSERT_IS_MAIN_THREAD();
-    return exec_subshell_internal(cmd, NULL, apply_exit_status);
+void update_read_limit() {
+    env_var_t limit = env_get_string(L"fish_read_limit");
+    if (limit.missing_or_empty()) {
+        s_read_limit = DEFAULT_READ_LIMIT;
+        return;
+    }
+
+    long long value = fish_wcstoll(limit.c_str());
+    if (errno || value < 0) {
+        fwprintf(stderr, L"ignoring fish_read_limit: value '%ls' is not an integer or is < 0\n",
+                 limit.c_str());
+        s_read_limit = DEFAULT_READ_LIMIT;
+    } else {
+        s_read_limit = (size_t)value;
+    }
 }
@@ -14,15 +14,10 @@
 ///
 /// I've put a fair bit of work into making builtins behave like other programs as far as pipes are
 /// concerned. Unlike i.e. bash, builtins can pipe to other builtins with arbitrary amounts of data,
-/// and so on. To do this, after a builtin is run in the real process, it forks and a dummy process
-/// is created, responsible for writing the output of the builtin. This is surprisingly cheap on my
-/// computer, probably because of the marvels of copy on write forking.
-///
-/// This rule is short circuited in the case where a builtin does not output to a pipe and does in
-/// fact not output anything. The speed improvement from this optimization is not noticable on a
-/// normal computer/OS in regular use, but the promiscous amounts of forking that resulted was
-/// responsible for a huge slowdown when using Valgrind as well as when doing complex
-/// command-specific completions.
+/// and so on. To do this, the output of a builtin is buffered, and written by fish itself to where
+/// its redirections say it goes once the builtin is done. Output for a pipe that the next process
+/// in the job hasn't drained yet is written by a background thread, so fish can go on launching
+/// that process.
 class job_t;
 class parser_t;
 void exec_job(parser_t &parser, job_t *j);
@@ -33,10 +28,33 @@ void exec_job(parser_t &parser, job_t *j);
 /// \param cmd the command to execute
 /// \param outputs The list to insert output into.
 ///
-/// \return the status of the last job to exit, or -1 if en error was encountered.
-int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool preserve_exit_status);
+/// \param out_discarded If not NULL, set to whether the output was discarded.
+///
+/// \return the status of the last job to exit, or -1 if en error was encountered. If the output is
+/// longer than fish_read_limit allows, it is discarded and the status is STATUS_READ_TOO_MUCH.
+int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool preserve_exit_status,
+                  bool *out_discarded = NULL);
 int exec_subshell(const wcstring &cmd, bool preserve_exit_status);
 
+/// The output and status of a command substitution that was run ahead of time.
+struct subshell_result_t {
+    wcstring cmd;
+    wcstring_list_t outputs;
+    int status;
+    // Whether the output was longer than fish_read_limit allows and was discarded.
+    bool discarded;
+};
+
+/// Runs the leading command substitutions in cmds that run a single external command and don't
+/// depend on the state of the shell, all at once, collecting their outputs concurrently. Adds the
+/// results to out_results, in the order of cmds. Nothing is run if fewer than two commands qualify.
+void exec_subshells_concurrently(const wcstring_list_t &cmds,
+                                 std::vector<subshell_result_t> *out_results);
+
+/// Update the limit on the output of a command substitution, in response to the fish_read_limit
+/// variable being set.
+void update_read_limit();
+
 /// Loops over close until the syscall was run without being interrupted.
 void exec_close(int fd);
 
@@ -12,6 +12,7 @@
 #include <wchar.h>
 #include <wctype.h>
 #include <algorithm>
+#include <deque>
 #ifdef HAVE_SYS_SYSCTL_H
 #include <sys/sysctl.h>  // IWYU pragma: keep
 #endif
@@ -78,6 +79,13 @@
 /// Unclean characters. See \c expand_is_clean().
 #define UNCLEAN L"$*?\\\"'({})"
 
+/// The command substitutions of the arguments being expanded that expand_prefetch_cmdsubsts
+/// already ran, in order. These are used up by expand_cmdsubst.
+static std::deque<subshell_result_t> s_prefetched_cmdsubsts;
+
+/// Whether the fish_concurrent_cmdsubst variable is true. Set by update_concurrent_cmdsubst().
+static bool s_concurrent_cmdsubst = false;
+
 static void remove_internal_separator(wcstring *s, bool conv);
 
 /// Test if the specified argument is clean, i.e. it does not contain any tokens which need to be
@@ -134,9 +142,9 @@ static void append_cmdsub_error(parse_error_list_t *errors, size_t source_start,
 }
 
 /// Return the environment variable value for the string starting at \c in.
-static env_var_t expand_var(const wchar_t *in) {
-    if (!in) return env_var_t::missing_var();
-    return env_get_string(in);
+static env_list_ref_t expand_var(const wchar_t *in, size_t max_count) {
+    if (!in) return env_list_ref_t();
+    return env_get_list(in, ENV_DEFAULT, max_count);
 }
 
 /// Test if the specified string does not contain character which can not be used inside a quoted
@@ -689,6 +697,25 @@ static size_t parse_slice(const wchar_t *in, wchar_t **end_ptr, std::vector<long
     return 0;
 }
 
+/// Returns how many leading elements of a variable are needed to expand it with the slice at
+/// slice_start, or all of them if there is no slice or it may contain negative indexes, which count
+/// from the end.
+static size_t slice_element_count(const wcstring &instr, size_t slice_start) {
+    const size_t all = (size_t)-1;
+    if (slice_start >= instr.size() || instr.at(slice_start) != L'[') return all;
+
+    const wchar_t *in = instr.c_str() + slice_start;
+    wchar_t *slice_end;
+    std::vector<long> idx;
+    std::vector<size_t> source_positions;
+    if (parse_slice(in, &slice_end, idx, source_positions, 0) != 0) return all;
+    if (std::find(in, (const wchar_t *)slice_end, L'-') != slice_end) return all;
+
+    long max_idx = 0;
+    for (size_t i = 0; i < idx.size(); i++) max_idx = std::max(max_idx, idx[i]);
+    return max_idx > 0 ? (size_t)max_idx : all;
+}
+
 /// Expand all environment variables in the string *ptr.
 ///
 /// This function is slow, fragile and complicated. There are lots of little corner cases, like
@@ -764,20 +791,19 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
         }
 
         var_tmp.append(instr, start_pos, var_len);
-        env_var_t var_val;
-        if (var_len == 1 && var_tmp[0] == VARIABLE_EXPAND_EMPTY) {
-            var_val = env_var_t::missing_var();
-        } else {
-            var_val = expand_var(var_tmp.c_str());
+        env_list_ref_t var_val;
+        if (var_len != 1 || var_tmp[0] != VARIABLE_EXPAND_EMPTY) {
+            var_val = expand_var(var_tmp.c_str(), slice_element_count(instr, stop_pos));
         }
 
-        if (!var_val.missing()) {
+        if (var_val) {
             int all_vars = 1;
-            wcstring_list_t var_item_list;
+            // The elements to expand to. These are the variable's own elements unless it is
+            // sliced, so that they don't need to be copied.
+            const wcstring_list_t *var_item_list = var_val.get();
+            wcstring_list_t string_values;
 
             if (is_ok) {
-                tokenize_variable_array(var_val, var_item_list);
-
                 const size_t slice_start = stop_pos;
                 if (slice_start < insize && instr.at(slice_start) == L'[') {
                     wchar_t *slice_end;
@@ -785,7 +811,7 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                     all_vars = 0;
                     const wchar_t *in = instr.c_str();
                     bad_pos = parse_slice(in + slice_start, &slice_end, var_idx_list, var_pos_list,
-                                          var_item_list.size());
+                                          var_item_list->size());
                     if (bad_pos != 0) {
                         append_syntax_error(errors, stop_pos + bad_pos, L"Invalid index value");
                         is_ok = false;
@@ -795,12 +821,12 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                 }
 
                 if (!all_vars) {
-                    wcstring_list_t string_values(var_idx_list.size());
+                    string_values.resize(var_idx_list.size());
                     for (size_t j = 0; j < var_idx_list.size(); j++) {
                         long tmp = var_idx_list.at(j);
                         // Check that we are within array bounds. If not, truncate the list to
                         // exit.
-                        if (tmp < 1 || (size_t)tmp > var_item_list.size()) {
+                        if (tmp < 1 || (size_t)tmp > var_item_list->size()) {
                             size_t var_src_pos = var_pos_list.at(j);
                             // The slice was parsed starting at stop_pos, so we have to add that
                             // to the error position.
@@ -814,12 +840,12 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                             // at the specified index.
                             // al_set( var_idx_list, j, wcsdup((const wchar_t *)al_get(
                             // &var_item_list, tmp-1 ) ) );
-                            string_values.at(j) = var_item_list.at(tmp - 1);
+                            string_values.at(j) = var_item_list->at(tmp - 1);
                         }
                     }
 
                     // string_values is the new var_item_list.
-                    var_item_list = std::move(string_values);
+                    var_item_list = &string_values;
                 }
             }
 
@@ -832,14 +858,14 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                 if (i > 0) {
                     if (instr.at(i - 1) != VARIABLE_EXPAND_SINGLE) {
                         res.push_back(INTERNAL_SEPARATOR);
-                    } else if (var_item_list.empty() || var_item_list.front().empty()) {
+                    } else if (var_item_list->empty() || var_item_list->front().empty()) {
                         // First expansion is empty, but we need to recursively expand.
                         res.push_back(VARIABLE_EXPAND_EMPTY);
                     }
                 }
 
-                for (size_t j = 0; j < var_item_list.size(); j++) {
-                    const wcstring &next = var_item_list.at(j);
+                for (size_t j = 0; j < var_item_list->size(); j++) {
+                    const wcstring &next = var_item_list->at(j);
                     if (is_ok) {
                         if (j != 0) res.append(L" ");
                         res.append(next);
@@ -849,8 +875,8 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                 res.append(instr, stop_pos, insize - stop_pos);
                 is_ok &= expand_variables(res, out, i, errors);
             } else {
-                for (size_t j = 0; j < var_item_list.size(); j++) {
-                    const wcstring &next = var_item_list.at(j);
+                for (size_t j = 0; j < var_item_list->size(); j++) {
+                    const wcstring &next = var_item_list->at(j);
                     if (is_ok && i == 0 && stop_pos == insize) {
                         append_completion(out, next);
                     } else {
@@ -1034,6 +1060,34 @@ static expand_error_t expand_brackets(const wcstring &instr, expand_flags_t flag
     return EXPAND_OK;
 }
 
+void expand_prefetch_cmdsubsts(const wcstring_list_t &args) {
+    ASSERT_IS_MAIN_THREAD();
+    s_prefetched_cmdsubsts.clear();
+    if (!s_concurrent_cmdsubst) return;
+
+    wcstring_list_t cmds;
+    for (size_t i = 0; i < args.size(); i++) {
+        const wchar_t *cursor = args.at(i).c_str();
+        wchar_t *paran_begin, *paran_end;
+        while (parse_util_locate_cmdsubst(cursor, &paran_begin, &paran_end, false) == 1) {
+            cmds.push_back(wcstring(paran_begin + 1, paran_end - paran_begin - 1));
+            cursor = paran_end + 1;
+        }
+    }
+    if (cmds.size() < 2) return;
+
+    std::vector<subshell_result_t> results;
+    exec_subshells_concurrently(cmds, &results);
+    s_prefetched_cmdsubsts.assign(results.begin(), results.end());
+}
+
+void expand_forget_prefetched_cmdsubsts() { s_prefetched_cmdsubsts.clear(); }
+
+void update_concurrent_cmdsubst() {
+    const env_var_t concurrent = env_get_string(L"fish_concurrent_cmdsubst");
+    s_concurrent_cmdsubst = !concurrent.missing_or_empty() && from_string<bool>(concurrent);
+}
+
 /// Perform cmdsubst expansion.
 static int expand_cmdsubst(const wcstring &input, std::vector<completion_t> *out_list,
                            parse_error_list_t *errors) {
@@ -1065,10 +1119,27 @@ static int expand_cmdsubst(const wcstring &input, std::vector<completion_t> *out
 
     const wcstring subcmd(paran_begin + 1, paran_end - paran_begin - 1);
 
-    if (exec_subshell(subcmd, sub_res, true /* do apply exit status */) == -1) {
+    int subshell_status;
+    bool discarded;
+    if (!s_prefetched_cmdsubsts.empty() && s_prefetched_cmdsubsts.front().cmd == subcmd) {
+        subshell_result_t &result = s_prefetched_cmdsubsts.front();
+        sub_res.swap(result.outputs);
+        subshell_status = result.status;
+        discarded = result.discarded;
+        proc_set_last_status(subshell_status);
+        s_prefetched_cmdsubsts.pop_front();
+    } else {
+        subshell_status =
+            exec_subshell(subcmd, sub_res, true /* do apply exit status */, &discarded);
+    }
+    if (subshell_status == -1) {
         append_cmdsub_error(errors, SOURCE_LOCATION_UNKNOWN,
                             L"Unknown error while evaulating command substitution");
         return 0;
+    } else if (discarded) {
+        append_cmdsub_error(errors, SOURCE_LOCATION_UNKNOWN,
+                            L"Too much data emitted by command substitution so it was discarded");
+        return 0;
     }
 
     tail_begin = paran_end + 1;
@@ -129,6 +129,19 @@ __warn_unused expand_error_t expand_string(const wcstring &input, std::vector<co
 /// \return Whether expansion succeded
 bool expand_one(wcstring &inout_str, expand_flags_t flags, parse_error_list_t *errors = NULL);
 
+/// If the fish_concurrent_cmdsubst variable is true, runs the command substitutions in args that
+/// only run an external command ahead of time and concurrently, with exec_subshells_concurrently.
+/// Expanding args in order with expand_string then uses their results. Call
+/// expand_forget_prefetched_cmdsubsts once done with args, in case some results were not used.
+/// Unlike with expand_string alone, the substitutions run even if expanding an earlier argument
+/// fails.
+void expand_prefetch_cmdsubsts(const wcstring_list_t &args);
+void expand_forget_prefetched_cmdsubsts();
+
+/// Update our idea of whether to prefetch command substitutions, from the fish_concurrent_cmdsubst
+/// variable.
+void update_concurrent_cmdsubst();
+
 /// Convert the variable value to a human readable form, i.e. escape things, handle arrays, etc.
 /// Suitable for pretty-printing. The result must be free'd!
 ///
@@ -55,6 +55,7 @@
 #include "parse_util.h"
 #include "parser.h"
 #include "path.h"
+#include "postfork.h"
 #include "proc.h"
 #include "reader.h"
 #include "screen.h"
@@ -69,12 +70,13 @@ static const char *const *s_arguments;
 static int s_test_run_count = 0;
 
 // Indicate if we should test the given function. Either we test everything (all arguments) or we
-// run only tests that have a prefix in s_arguments.
-static bool should_test_function(const char *func_name) {
+// run only tests that have a prefix in s_arguments. Tests that are not on by default, like
+// expensive benchmarks, only run when asked for.
+static bool should_test_function(const char *func_name, bool default_on = true) {
     // No args, test everything.
     bool result = false;
     if (!s_arguments || !s_arguments[0]) {
-        result = true;
+        result = default_on;
     } else {
         for (size_t i = 0; s_arguments[i] != NULL; i++) {
             if (!strncmp(func_name, s_arguments[i], strlen(s_arguments[i]))) {
@@ -715,6 +717,156 @@ static void test_parser() {
     do_test(comps.at(2).completion == L"delta");
 }
 
+/// Test that command substitution buffers decode their output as it arrives.
+static void test_cmdsubst_buffer() {
+    say(L"Testing command substitution buffers");
+    // An e with an acute accent, split between two chunks, then a line without a newline. How the
+    // accent decodes depends on the locale.
+    const char *const chunks[] = {"ab\nc\xc3", "\xa9\n\n", "d"};
+    const wcstring e_acute = str2wcstring("c\xc3\xa9");
+    const wcstring split_lines[] = {L"ab", e_acute, L"", L"d"};
+
+    shared_ptr<io_buffer_t> split(io_buffer_t::create_for_cmdsubst(true, 0));
+    shared_ptr<io_buffer_t> joined(io_buffer_t::create_for_cmdsubst(false, 0));
+    shared_ptr<io_buffer_t> limited(io_buffer_t::create_for_cmdsubst(true, 8));
+    for (const char *chunk : chunks) {
+        split->out_buffer_append(chunk, strlen(chunk));
+        joined->out_buffer_append(chunk, strlen(chunk));
+        limited->out_buffer_append(chunk, strlen(chunk));
+    }
+
+    wcstring_list_t lines;
+    do_test(split->take_lines(&lines));
+    do_test(lines == wcstring_list_t(split_lines, split_lines + 4));
+    do_test(joined->take_lines(&lines));
+    do_test(lines == wcstring_list_t(1, L"ab\n" + e_acute + L"\n\nd"));
+    do_test(!limited->take_lines(&lines));
+    do_test(lines.empty());
+
+    // No output is no lines, or one empty string if the lines aren't split.
+    split = io_buffer_t::create_for_cmdsubst(true, 0);
+    joined = io_buffer_t::create_for_cmdsubst(false, 0);
+    joined->out_buffer_append("\n", 1);
+    do_test(split->take_lines(&lines) && lines.empty());
+    do_test(joined->take_lines(&lines) && lines == wcstring_list_t(1, L""));
+}
+
+/// Test that command substitutions of external commands run at the same time when asked to, and
+/// that their results still come out in order.
+static void test_concurrent_cmdsubst() {
+    say(L"Testing concurrent command substitutions");
+    parser_t &parser = parser_t::principal_parser();
+    const wcstring flag = L"/tmp/fish_concurrent_cmdsubst_test";
+    wunlink(flag);
+    // The first command only prints once the second has run. If they ran one after the other, it
+    // would give up after a second.
+    const wcstring cmd = L"set -g __fish_test_cmdsubst "
+                         L"(sh -c 'for i in 1 2 3 4 5 6 7 8 9 10; do test -e " + flag +
+                         L" && break; sleep 0.1; done; test -e " + flag + L" && echo a') "
+                         L"(sh -c 'touch " + flag + L"; echo b; exit 3')";
+
+    env_set(L"fish_concurrent_cmdsubst", L"1", ENV_GLOBAL);
+    parser.eval(cmd, io_chain_t(), TOP);
+    env_remove(L"fish_concurrent_cmdsubst", ENV_GLOBAL);
+    wunlink(flag);
+
+    env_var_t result = env_get_string(L"__fish_test_cmdsubst");
+    if (result != L"a" ARRAY_SEP_STR L"b") {
+        err(L"Unexpected result of concurrent command substitutions: '%ls'", result.c_str());
+    }
+    do_test(proc_get_last_status() == 3);
+
+    // A local setting goes away with its scope. The first command then runs alone and gives up.
+    // Waiting for the commands run one after the other relies on fish's SIGCHLD handler.
+    signal_set_handlers();
+    env_push(true);
+    env_set(L"fish_concurrent_cmdsubst", L"1", ENV_LOCAL);
+    env_pop();
+    parser.eval(cmd, io_chain_t(), TOP);
+    wunlink(flag);
+    do_test(env_get_string(L"__fish_test_cmdsubst") == ARRAY_SEP_STR L"b");
+    env_remove(L"__fish_test_cmdsubst", ENV_GLOBAL);
+}
+
+/// Test that pipelines with blocks in them need no fork beyond their external commands under job
+/// control, and still work when the job's first process is reaped before the rest are launched.
+static void test_job_control_forks() {
+    say(L"Testing forks for job control pipelines");
+    const int saved_job_control_mode = job_control_mode;
+    const int saved_is_subshell = is_subshell;
+    // Use process groups, but leave the terminal alone. Waiting for the commands in a block relies
+    // on fish's SIGCHLD handler.
+    job_control_mode = JOB_CONTROL_ALL;
+    is_subshell = 1;
+    signal_set_handlers();
+
+    parser_t &parser = parser_t::principal_parser();
+    int fork_count = g_fork_count;
+    parser.eval(L"begin; end | /bin/true", io_chain_t(), TOP);
+    do_test(g_fork_count - fork_count == 1);
+
+    shared_ptr<io_buffer_t> out_buff(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
+    parser.eval(L"/bin/true | begin; /bin/true; echo x; end | cat", io_chain_t(out_buff), TOP);
+    out_buff->read();
+    do_test(std::string(out_buff->out_buffer_ptr(), out_buff->out_buffer_size()) == "x\n");
+    do_test(proc_get_last_status() == 0);
+
+    // A builtin streams its output into a slow reader. It waits whenever the pipe is full.
+    const wcstring out_path = L"/tmp/fish_test_job_control_stream.txt";
+    parser.eval(L"printf '%0100000d\\n' 0 | sh -c 'sleep 0.1; wc -c' >" + out_path, io_chain_t(),
+                TOP);
+    out_buff = io_buffer_t::create(STDOUT_FILENO, io_chain_t());
+    parser.eval(L"string trim <" + out_path, io_chain_t(out_buff), TOP);
+    out_buff->read();
+    do_test(std::string(out_buff->out_buffer_ptr(), out_buff->out_buffer_size()) == "100001\n");
+    wunlink(out_path);
+
+    // A builtin writing more than a pipe holds to a process that stops must not keep fish from
+    // seeing the job stop.
+    parser.eval(L"printf '%0100000d\\n' 0 | sh -c 'kill -STOP $$; cat >/dev/null'", io_chain_t(),
+                TOP);
+    job_t *stopped = NULL;
+    job_iterator_t jobs;
+    while (job_t *j = jobs.next()) {
+        if (job_is_stopped(j) && !job_is_completed(j)) stopped = j;
+    }
+    if (stopped == NULL) {
+        err(L"Job with a stopped reader was not reported as stopped");
+    } else {
+        const job_id_t stopped_id = stopped->job_id;
+        killpg(stopped->pgid, SIGKILL);
+        for (int i = 0; i < 100 && job_get(stopped_id) != NULL; i++) {
+            usleep(10 * 1000);
+            job_reap(false);
+        }
+        do_test(job_get(stopped_id) == NULL);
+    }
+
+    job_control_mode = saved_job_control_mode;
+    is_subshell = saved_is_subshell;
+}
+
+static void test_builtin_output() {
+    say(L"Testing that builtin output is written without forking");
+    parser_t &parser = parser_t::principal_parser();
+    int fork_count = g_fork_count;
+
+    // The output is larger than a pipe buffer, and the builtin reading it runs after the one
+    // writing it.
+    shared_ptr<io_buffer_t> out_buff(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
+    parser.eval(L"printf '%0100000d\\n' 0 >&1 | string length", io_chain_t(out_buff), TOP);
+    out_buff->read();
+    do_test(std::string(out_buff->out_buffer_ptr(), out_buff->out_buffer_size()) == "100000\n");
+
+    out_buff = io_buffer_t::create(STDOUT_FILENO, io_chain_t());
+    parser.eval(L"echo x 2>&1 1>&2 | string replace x y; "
+                L"echo z 3>&1 >/dev/null 2>&3 | string match z",
+                io_chain_t(out_buff), TOP);
+    out_buff->read();
+    do_test(std::string(out_buff->out_buffer_ptr(), out_buff->out_buffer_size()) == "y\n");
+    do_test(g_fork_count == fork_count);
+}
+
 static void test_1_cancellation(const wchar_t *src) {
     shared_ptr<io_buffer_t> out_buff(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
     const io_chain_t io_chain(out_buff);
@@ -1846,6 +1998,74 @@ static void test_is_potential_path() {
     do_test(is_potential_path(L"/usr", wds, PATH_REQUIRE_DIR));
 }
 
+/// Test the shared cache of path statuses.
+static void test_path_statuses() {
+    say(L"Testing path statuses");
+    if (system("rm -Rf /tmp/path_status_test/")) err(L"Failed to remove /tmp/path_status_test/");
+    if (system("mkdir -p /tmp/path_status_test/dir/")) err(L"mkdir failed");
+    if (system("touch /tmp/path_status_test/file")) err(L"touch failed");
+    const wcstring dir = L"/tmp/path_status_test/dir";
+    const wcstring file = L"/tmp/path_status_test/file";
+    const wcstring missing = L"/tmp/path_status_test/missing";
+
+    wcstring_list_t paths;
+    paths.push_back(dir);
+    paths.push_back(file);
+    paths.push_back(missing);
+    paths.push_back(dir);
+    std::vector<path_status_t> statuses = path_get_statuses(paths);
+    do_test(statuses.size() == 4);
+    do_test(statuses.at(0) == PATH_STATUS_DIRECTORY);
+    do_test(statuses.at(1) == PATH_STATUS_OTHER);
+    do_test(statuses.at(2) == PATH_STATUS_MISSING);
+    do_test(statuses.at(3) == PATH_STATUS_DIRECTORY);
+
+    // Statuses are cached until they expire or are invalidated.
+    if (system("rm /tmp/path_status_test/file")) err(L"rm failed");
+    do_test(path_get_status(file) == PATH_STATUS_OTHER);
+    path_invalidate_statuses();
+    do_test(path_get_status(file) == PATH_STATUS_MISSING);
+
+    // A check that doesn't finish in time still fills the cache.
+    if (system("touch /tmp/path_status_test/file")) err(L"touch failed");
+    path_invalidate_statuses();
+    path_get_statuses(wcstring_list_t(1, file), 0);
+    iothread_drain_all();
+    do_test(path_get_statuses(wcstring_list_t(1, file), 0).front() == PATH_STATUS_OTHER);
+
+    // Checks without a timeout don't wait on the pool they run on, even when all its threads do.
+    path_invalidate_statuses();
+    int statuses_found = 0;
+    static volatile bool checks_may_start;
+    checks_may_start = false;
+    for (int i = 0; i < 256; i++) {
+        wcstring_list_t some_paths;
+        some_paths.push_back(file);
+        some_paths.push_back(missing + to_string(i));
+        some_paths.push_back(missing + to_string(i) + L"/sub");
+        iothread_perform(
+            [some_paths]() {
+                while (!checks_may_start) usleep(1000);
+                return path_get_statuses(some_paths).at(0);
+            },
+            [&statuses_found](path_status_t status) {
+                if (status == PATH_STATUS_OTHER) statuses_found++;
+            });
+    }
+    checks_may_start = true;
+    iothread_drain_all();
+    do_test(statuses_found == 256);
+
+    // The history's path validation goes through the cache.
+    const wcstring wd = L"/tmp/path_status_test/";
+    const wchar_t *const relative_paths[] = {L"dir", L"missing", L".", L"../", L"file"};
+    const path_list_t relative(relative_paths, relative_paths + 5);
+    const wchar_t *const expected_valid[] = {L"dir", L".", L"../", L"file"};
+    do_test(valid_paths(relative, wd) == path_list_t(expected_valid, expected_valid + 4));
+    do_test(!all_paths_are_valid(relative, wd, 100));
+    do_test(all_paths_are_valid(path_list_t(expected_valid, expected_valid + 4), wd, 100));
+}
+
 /// Test the 'test' builtin.
 int builtin_test(parser_t &parser, io_streams_t &streams, wchar_t **argv);
 static bool run_one_test_test(int expected, wcstring_list_t &lst, bool bracket) {
@@ -2702,6 +2922,16 @@ class history_tests_t {
     static void test_history(void);
     static void test_history_merge(void);
     static void test_history_formats(void);
+    static void test_history_index(void);
+    static void test_history_incorporate(void);
+    static void test_history_vacuum(void);
+    static void test_history_item_cache(void);
+    static void test_history_time_range(void);
+    static void test_history_item_encoding(void);
+    static void test_history_batching(void);
+    static void test_history_search_index(void);
+    static void test_history_parallel_search(void);
+    static void test_history_scan_speed(void);
     // static void test_history_speed(void);
     static void test_history_races(void);
     static void test_history_races_pound_on_history(size_t item_count);
@@ -2797,7 +3027,7 @@ void history_tests_t::test_history(void) {
 
         // Record this item.
         history_item_t item(value, time(NULL));
-        item.required_paths = paths;
+        item.set_required_paths(paths);
         before.push_back(item);
         history.add(item);
     }
@@ -2814,7 +3044,7 @@ void history_tests_t::test_history(void) {
         const history_item_t &bef = before.at(i), &aft = after.at(i);
         do_test(bef.contents == aft.contents);
         do_test(bef.creation_timestamp == aft.creation_timestamp);
-        do_test(bef.required_paths == aft.required_paths);
+        do_test(bef.get_required_paths() == aft.get_required_paths());
     }
 
     // Clean up after our tests.
@@ -2862,6 +3092,9 @@ void history_tests_t::test_history_races(void) {
     // Ensure history is clear.
     history_t(L"race_test").clear();
 
+    // Background history work (like vacuuming) must not be in flight across fork.
+    iothread_drain_all();
+
     pid_t children[RACE_COUNT];
     for (size_t i = 0; i < RACE_COUNT; i++) {
         pid_t pid = fork();
@@ -2904,7 +3137,7 @@ void history_tests_t::test_history_races(void) {
 
         bool found = false;
         for (wcstring_list_t &list : expected_lines) {
-            auto iter = std::find(list.begin(), list.end(), item.contents);
+            auto iter = std::find(list.begin(), list.end(), item.str());
             if (iter != list.end()) {
                 found = true;
 
@@ -3006,6 +3239,14 @@ void history_tests_t::test_history_merge(void) {
         do_test(string_rep == string_rep2);
     }
 
+    // Getting only the most recent items, as for $history[1..2], gives a prefix of all of them.
+    wcstring_list_t all_items, recent_items;
+    hists[0]->get_unique_items(&all_items);
+    hists[0]->get_unique_items(&recent_items, 2);
+    do_test(all_items.size() > 2);
+    do_test(recent_items.size() == 2);
+    do_test(std::equal(recent_items.begin(), recent_items.end(), all_items.begin()));
+
     // Add some more per-history items.
     for (size_t i = 0; i < count; i++) {
         hists[i]->add(alt_texts[i]);
@@ -3088,6 +3329,580 @@ static bool history_equals(history_t &hist, const wchar_t *const *strings) {
     return true;
 }
 
+void history_tests_t::test_history_index(void) {
+    say(L"Testing history index");
+    const wcstring name = L"index_test";
+    wcstring index_path;
+    if (!path_get_data(index_path)) {
+        err(L"Failed to get data directory");
+        return;
+    }
+    index_path.append(L"/" + name + L"_history.idx");
+
+    std::unique_ptr<history_t> writer = make_unique<history_t>(name);
+    writer->clear();
+    time_barrier();
+    writer->add(L"first");
+    writer->add(L"second");
+    writer->save();
+
+    // Saving creates the index, and loading the history uses it.
+    struct stat buf;
+    do_test(wstat(index_path, &buf) == 0 && buf.st_size > 0);
+    time_barrier();
+    std::unique_ptr<history_t> hist = make_unique<history_t>(name);
+    const wchar_t *const two_items[] = {L"second", L"first", NULL};
+    history_equals(*hist, two_items);
+
+    // Loading doesn't create a missing index.
+    wunlink(index_path);
+    hist = make_unique<history_t>(name);
+    history_equals(*hist, two_items);
+    do_test(wstat(index_path, &buf) != 0);
+
+    // Appended items are added to the index.
+    writer->add(L"third");
+    writer->save();
+    time_barrier();
+    hist = make_unique<history_t>(name);
+    const wchar_t *const three_items[] = {L"third", L"second", L"first", NULL};
+    history_equals(*hist, three_items);
+
+    // Items newer than the history are still ignored.
+    time_barrier();
+    hist = make_unique<history_t>(name);
+    time_barrier();
+    writer->add(L"fourth");
+    writer->save();
+    history_equals(*hist, three_items);
+
+    // A corrupt index is ignored, and rebuilt by the next save.
+    FILE *f = wfopen(index_path, "w");
+    do_test(f != NULL);
+    if (f) {
+        fputs("garbage that is long enough to look like a header", f);
+        fclose(f);
+    }
+    time_barrier();
+    hist = make_unique<history_t>(name);
+    const wchar_t *const four_items[] = {L"fourth", L"third", L"second", L"first", NULL};
+    history_equals(*hist, four_items);
+    writer->add(L"fifth");
+    writer->save();
+    do_test(wstat(index_path, &buf) == 0 && buf.st_size > 100);  // the header and five entries
+
+    writer->clear();
+    do_test(wstat(index_path, &buf) != 0);
+}
+
+void history_tests_t::test_history_incorporate(void) {
+    say(L"Testing incorporating appended history");
+    const wcstring name = L"incorporate_test";
+    std::unique_ptr<history_t> writer = make_unique<history_t>(name);
+    writer->clear();
+    // Save only when asked to, so that a vacuum doesn't replace the file behind our backs.
+    writer->disable_automatic_saving();
+    writer->add(L"first");
+    writer->add(L"second");
+    writer->save();
+    time_barrier();
+
+    // Items written after this instance started are left out, until it incorporates them.
+    std::unique_ptr<history_t> hist = make_unique<history_t>(name);
+    time_barrier();
+    writer->add(L"third");
+    writer->save();
+    const wchar_t *const two_items[] = {L"second", L"first", NULL};
+    history_equals(*hist, two_items);
+    do_test(hist->deferred_old_items.size() == 1);
+
+    // An append is incorporated without reloading the file.
+    writer->add(L"fourth");
+    writer->save();
+    time_barrier();
+    hist->incorporate_external_changes();
+    do_test(hist->loaded_old);
+    do_test(hist->deferred_old_items.empty());
+    const wchar_t *const four_items[] = {L"fourth", L"third", L"second", L"first", NULL};
+    history_equals(*hist, four_items);
+
+    // A rewrite means a reload.
+    {
+        scoped_lock locker(writer->lock);
+        writer->new_items.push_back(history_item_t(L"fifth", time(NULL)));
+        writer->save_internal(true);
+    }
+    time_barrier();
+    hist->incorporate_external_changes();
+    do_test(!hist->loaded_old);
+    const wchar_t *const five_items[] = {L"fifth", L"fourth", L"third", L"second", L"first", NULL};
+    history_equals(*hist, five_items);
+
+    writer->clear();
+}
+
+void history_tests_t::test_history_item_encoding(void) {
+    say(L"Testing compact history items");
+    const wcstring strs[] = {L"",
+                             L"echo plain ascii",
+                             L"echo caf\u00e9 \u4e2d\u6587 \U0001F41F",
+                             wcstring(1, (wchar_t)0xD800) + L"lone surrogate",
+                             wcstring(1, (wchar_t)0x110000) + wcstring(1, (wchar_t)0x7FFFFFFF),
+                             wcstring(1, (wchar_t)-1) + wcstring(1, ENCODE_DIRECT_BASE + 0xFF)};
+    for (const wcstring &str : strs) {
+        history_item_t item(str);
+        if (item.str() != str) err(L"History item did not round-trip: '%ls'", str.c_str());
+    }
+
+    // ASCII takes a byte per character, and we don't keep a lowercase copy around.
+    history_item_t item(L"Echo MiXeD Case");
+    do_test(item.contents.size() == 15);
+    do_test(item.str_lower() == L"echo mixed case");
+    do_test(item.matches_search(L"mixed", HISTORY_SEARCH_TYPE_CONTAINS, false));
+    do_test(!item.matches_search(L"mixed", HISTORY_SEARCH_TYPE_CONTAINS, true));
+    do_test(item.matches_search(L"Echo Mi", HISTORY_SEARCH_TYPE_PREFIX, true));
+    do_test(!item.matches_search(L"Echo Mi", HISTORY_SEARCH_TYPE_EXACT, true));
+    do_test(item.matches_search(L"ECHO mixed CASE", HISTORY_SEARCH_TYPE_EXACT, false));
+    do_test(!item.matches_search(L"echo mixed cas", HISTORY_SEARCH_TYPE_EXACT, false));
+    do_test(item.matches_search(L"echo mI", HISTORY_SEARCH_TYPE_PREFIX, false));
+    do_test(!item.matches_search(L"mixed", HISTORY_SEARCH_TYPE_PREFIX, false));
+    do_test(!item.matches_search(L"cases", HISTORY_SEARCH_TYPE_CONTAINS, false));
+
+    // Matching ignores case among multibyte characters too.
+    history_item_t wide(L"\u4e2d caf\u00e9 \u4e2d");
+    do_test(wide.matches_search(L"AF\u00e9 \u4e2d", HISTORY_SEARCH_TYPE_CONTAINS, false));
+    do_test(!wide.matches_search(L"\u4e2d\u4e2d", HISTORY_SEARCH_TYPE_CONTAINS, false));
+
+    // Copies share their required paths.
+    item.set_required_paths(path_list_t(1, L"/tmp"));
+    history_item_t copy = item;
+    do_test(&copy.get_required_paths() == &item.get_required_paths());
+    do_test(copy == item);
+}
+
+void history_tests_t::test_history_item_cache(void) {
+    say(L"Testing the cache of decoded history items");
+    std::unique_ptr<history_t> writer = make_unique<history_t>(L"item_cache_test");
+    writer->clear();
+    writer->add(L"first");
+    writer->add(L"second");
+    writer->save();
+    time_barrier();
+
+    std::unique_ptr<history_t> hist = make_unique<history_t>(L"item_cache_test");
+    size_t hits, misses;
+    do_test(hist->item_at_index(1).str() == L"second");
+    do_test(hist->item_at_index(2).str() == L"first");
+    do_test(hist->item_at_index(1).str() == L"second");
+    hist->get_item_cache_stats(&hits, &misses);
+    do_test(hits == 1 && misses == 2);
+
+    // New items don't go through the cache.
+    hist->add(L"third");
+    do_test(hist->item_at_index(1).str() == L"third");
+    do_test(hist->item_at_index(2).str() == L"second");
+    hist->get_item_cache_stats(&hits, &misses);
+    do_test(hits == 2 && misses == 2);
+
+    // The cache goes away with the mapping.
+    {
+        scoped_lock locker(hist->lock);
+        hist->clear_file_state();
+    }
+    do_test(hist->item_at_index(2).str() == L"second");
+    hist->get_item_cache_stats(&hits, &misses);
+    do_test(hits == 2 && misses == 3);
+
+    hist->clear();
+}
+
+void history_tests_t::test_history_time_range(void) {
+    say(L"Testing searching history by time range");
+    wcstring path;
+    if (!path_get_data(path)) {
+        err(L"Failed to get data directory");
+        return;
+    }
+    path.append(L"/time_range_test_history");
+
+    // The timestamps are a little out of order, as they are when sessions save concurrently.
+    const char *contents =
+        "- cmd: alpha\n  when: 100\n"
+        "- cmd: beta\n  when: 200\n"
+        "- cmd: gamma\n  when: 150\n"
+        "- cmd: delta\n  when: 300\n"
+        "- cmd: zeta\n  when: 400\n";
+    FILE *f = wfopen(path, "w");
+    if (f == NULL || fputs(contents, f) == EOF) {
+        err(L"Couldn't write history file");
+        if (f) fclose(f);
+        return;
+    }
+    fclose(f);
+
+    history_t hist(L"time_range_test");
+    hist.disable_automatic_saving();
+    hist.add(history_item_t(L"epsilon", 500));
+    hist.add(history_item_t(L"beta", 600));
+    {
+        scoped_lock locker(hist.lock);
+        hist.load_old_if_needed();
+        size_t begin, end;
+        hist.old_items_in_time_range(0, std::numeric_limits<time_t>::max(), &begin, &end);
+        do_test(begin == 0 && end == 5);
+        hist.old_items_in_time_range(180, 250, &begin, &end);
+        do_test(begin == 1 && end == 3);
+        hist.old_items_in_time_range(401, 1000, &begin, &end);
+        do_test(begin == end);
+    }
+
+    const struct {
+        const wchar_t *term;
+        time_t since;
+        time_t until;
+        const wchar_t *expected;
+    } searches[] = {
+        {L"", 150, 300, L"delta\ngamma\nbeta\n"},
+        {L"", 300, 500, L"epsilon\nzeta\ndelta\n"},
+        {L"", 0, 120, L"alpha\n"},
+        {L"beta", 0, 250, L"beta\n"},
+        {L"beta", 0, std::numeric_limits<time_t>::max(), L"beta\n"},
+        {L"a", 160, 450, L"zeta\ndelta\nbeta\n"},
+        {L"", 700, 800, L""},
+    };
+    for (size_t i = 0; i < sizeof searches / sizeof *searches; i++) {
+        wcstring_list_t terms;
+        if (*searches[i].term) terms.push_back(searches[i].term);
+        io_streams_t streams;
+        do_test(hist.search(HISTORY_SEARCH_TYPE_CONTAINS, terms, NULL, LONG_MAX, false, false,
+                            streams, searches[i].since, searches[i].until));
+        if (streams.out.buffer() != searches[i].expected) {
+            err(L"Searching for '%ls' from %ld to %ld gave '%ls'", searches[i].term,
+                (long)searches[i].since, (long)searches[i].until, streams.out.buffer().c_str());
+        }
+    }
+
+    hist.clear();
+}
+
+void history_tests_t::test_history_vacuum(void) {
+    say(L"Testing vacuuming history in the background");
+    std::unique_ptr<history_t> hist = make_unique<history_t>(L"vacuum_test");
+    hist->clear();
+    hist->disable_automatic_saving();
+    hist->add(L"first");
+    hist->add(L"second");
+    hist->add(L"first");
+    {
+        scoped_lock locker(hist->lock);
+        hist->save_internal(false);
+        hist->vacuum_in_background();
+        do_test(hist->vacuum_in_progress);
+    }
+    iothread_drain_all();
+
+    // The vacuumed file is taken over, with our own items waiting to become old.
+    do_test(!hist->vacuum_in_progress);
+    do_test(hist->loaded_old);
+    do_test(hist->old_item_offsets.empty());
+    do_test(hist->deferred_old_items.size() == 2);
+
+    // The duplicate is gone from the file.
+    time_barrier();
+    history_t reader(L"vacuum_test");
+    const wchar_t *const two_items[] = {L"first", L"second", NULL};
+    history_equals(reader, two_items);
+
+    hist->clear();
+}
+
+void history_tests_t::test_history_batching(void) {
+    say(L"Testing batched history appends");
+    env_set(L"fish_history_flush_items", L"4", ENV_GLOBAL);
+    std::unique_ptr<history_t> hist = make_unique<history_t>(L"batching_test");
+    hist->clear();
+    hist->add(L"first");
+    hist->add(L"second");
+    hist->add(L"third");
+    do_test(hist->first_unwritten_new_item_index == 0);
+    do_test(hist->flushes_saved == 3);
+
+    // The fourth item flushes all of them.
+    hist->add(L"fourth");
+    do_test(hist->first_unwritten_new_item_index == 4);
+    do_test(hist->flushes_saved == 3);
+    time_barrier();
+    const wchar_t *const four_items[] = {L"fourth", L"third", L"second", L"first", NULL};
+    history_equals(*make_unique<history_t>(L"batching_test"), four_items);
+
+    // Saving flushes whatever is waiting.
+    hist->add(L"fifth");
+    do_test(hist->first_unwritten_new_item_index == 4);
+    hist->save();
+    do_test(hist->first_unwritten_new_item_index == 5);
+
+    // So does a timeout, as of the next item.
+    env_set(L"fish_history_flush_delay_ms", L"10", ENV_GLOBAL);
+    hist->add(L"sixth");
+    do_test(hist->first_unwritten_new_item_index == 5);
+    usleep(20 * 1000);
+    hist->add(L"seventh");
+    do_test(hist->first_unwritten_new_item_index == 7);
+
+    // Or without one, once the reader finds it due.
+    hist->add(L"eighth");
+    do_test(hist->next_flush_time() > 0);
+    hist->save_if_due();
+    do_test(hist->first_unwritten_new_item_index == 7);
+    usleep(20 * 1000);
+    hist->save_if_due();
+    do_test(hist->first_unwritten_new_item_index == 8);
+    do_test(hist->next_flush_time() == 0);
+
+    env_remove(L"fish_history_flush_items", ENV_GLOBAL);
+    env_remove(L"fish_history_flush_delay_ms", ENV_GLOBAL);
+    hist->clear();
+}
+
+/// Returns all matches of a history search, most recent first.
+static wcstring_list_t history_search_results(history_t &hist, const wcstring &term,
+                                              history_search_type_t type,
+                                              bool case_sensitive) {
+    wcstring_list_t results;
+    history_search_t searcher(hist, term, type, case_sensitive);
+    while (searcher.go_backwards()) {
+        results.push_back(searcher.current_string());
+    }
+    return results;
+}
+
+void history_tests_t::test_history_search_index(void) {
+    say(L"Testing history search index");
+    const wcstring name = L"search_index_test";
+    std::unique_ptr<history_t> writer = make_unique<history_t>(name);
+    writer->clear();
+    time_barrier();
+    // Enough items with a common prefix that prefix searches fetch several batches of candidates.
+    for (int i = 0; i < 100; i++) {
+        writer->add(format_string(L"make -j%d", i));
+    }
+    const wchar_t *const old_texts[] = {L"git commit", L"git status", L"Make install", L"ls -la",
+                                        L"make", L"cat GITHUB", L"echo tigger", L"echo a\\b",
+                                        L"echo a\nb", L"echo a\\nb", L"make -j5"};
+    for (size_t i = 0; i < sizeof old_texts / sizeof *old_texts; i++) {
+        writer->add(old_texts[i]);
+    }
+    writer->save();
+    time_barrier();
+
+    std::unique_ptr<history_t> hist = make_unique<history_t>(name);
+    hist->add(L"git push");
+    hist->add(L"echo new");
+
+    const history_search_type_t contains = HISTORY_SEARCH_TYPE_CONTAINS;
+    const history_search_type_t prefix = HISTORY_SEARCH_TYPE_PREFIX;
+    const struct {
+        const wchar_t *term;
+        history_search_type_t type;
+        bool case_sensitive;
+    } searches[] = {{L"git", contains, true},     {L"git", contains, false},
+                    {L"MAKE", contains, false},   {L"ake", contains, true},
+                    {L"g", contains, true},       {L"xyz", contains, true},
+                    {L"ls -", contains, true},    {L"echo", contains, true},
+                    {L"git", prefix, true},       {L"make -j1", prefix, true},
+                    {L"make", prefix, true},      {L"Make", prefix, false},
+                    {L"", prefix, true},          {L"echo a\\", prefix, true},
+                    {L"echo a\n", prefix, true}, {L"echo a\\n", prefix, true},
+                    {L"e", prefix, true},         {L"zz", prefix, true}};
+    std::vector<wcstring_list_t> expected;
+    for (size_t i = 0; i < sizeof searches / sizeof *searches; i++) {
+        expected.push_back(history_search_results(*hist, searches[i].term, searches[i].type,
+                                                  searches[i].case_sensitive));
+    }
+    do_test(expected.at(0).size() == 3);
+    do_test(expected.at(1).size() == 4);
+    do_test(expected.at(9).size() == 11);
+    do_test(expected.at(10).size() == 101);
+    do_test(expected.at(13).size() == 2);
+    do_test(expected.at(14).size() == 1);
+
+    // Small histories are searched without an index.
+    std::vector<size_t> candidates;
+    hist->build_search_index_in_background();
+    iothread_drain_all();
+    do_test(!hist->get_contains_candidates(L"git", &candidates));
+
+    // Searches with the index find the same items.
+    auto check_indexed_searches = [&](const wchar_t *when) {
+        for (size_t i = 0; i < sizeof searches / sizeof *searches; i++) {
+            wcstring_list_t results = history_search_results(
+                *hist, searches[i].term, searches[i].type, searches[i].case_sensitive);
+            if (results != expected.at(i)) {
+                err(L"Indexed search for '%ls' %ls found %lu items, expected %lu",
+                    searches[i].term, when, results.size(), expected.at(i).size());
+            }
+        }
+    };
+    hist->build_search_index();
+    do_test(hist->get_contains_candidates(L"git", &candidates));
+    do_test(!hist->get_contains_candidates(L"gi", &candidates));
+    bool complete = false;
+    do_test(hist->get_prefix_candidates(L"make -j", 10, &candidates, &complete));
+    do_test(!complete && candidates.size() == 12);
+    do_test(hist->get_prefix_candidates(L"git", 10, &candidates, &complete));
+    do_test(complete && candidates.size() == 4);
+    check_indexed_searches(L"when built");
+
+    // The index stays in use when items are appended to the file, and can be extended by them.
+    time_barrier();
+    hist->incorporate_external_changes();
+    do_test(hist->get_contains_candidates(L"git", &candidates));
+    check_indexed_searches(L"after appending");
+    hist->build_search_index();
+    check_indexed_searches(L"when extended");
+
+    // Vacuuming moves the index over to the rewritten file.
+    {
+        scoped_lock locker(hist->lock);
+        hist->vacuum_in_background();
+    }
+    iothread_drain_all();
+    do_test(hist->get_contains_candidates(L"git", &candidates));
+    check_indexed_searches(L"after vacuuming");
+
+    // The index goes stale when another shell rewrites the file.
+    writer->remove(L"cat GITHUB");
+    writer->save();
+    time_barrier();
+    hist->incorporate_external_changes();
+    do_test(!hist->get_contains_candidates(L"git", &candidates));
+
+    writer->clear();
+}
+
+void history_tests_t::test_history_parallel_search(void) {
+    say(L"Testing parallel history search");
+    const wcstring name = L"parallel_search_test";
+    std::unique_ptr<history_t> writer = make_unique<history_t>(name);
+    writer->clear();
+    time_barrier();
+    // Save several rounds, so that the file has duplicates spread over many chunks.
+    writer->disable_automatic_saving();
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 1200; i++) {
+            writer->add(format_string(L"echo %d %ls", (i * 7 + round) % 1500,
+                                      i % 3 ? L"lower" : L"UPPER"));
+        }
+        writer->save();
+    }
+    writer->enable_automatic_saving();
+    time_barrier();
+
+    history_t hist(name);
+    hist.add(L"echo 42 new");
+    hist.load_old_if_needed();
+    do_test(hist.old_item_offsets.size() == 3600);
+    const wchar_t *const time_format = L"%Y-%m-%d %H:%M:%S ";
+    const struct {
+        const wchar_t *term;
+        history_search_type_t type;
+        bool case_sensitive;
+        long max_items;
+        bool show_time;
+        bool null_terminate;
+    } searches[] = {{L"42", HISTORY_SEARCH_TYPE_CONTAINS, true, LONG_MAX, false, false},
+                    {L"upper", HISTORY_SEARCH_TYPE_CONTAINS, false, LONG_MAX, true, false},
+                    {L"echo 1", HISTORY_SEARCH_TYPE_PREFIX, true, LONG_MAX, false, true},
+                    {L"echo 1", HISTORY_SEARCH_TYPE_PREFIX, true, 1000, true, false},
+                    {L"echo", HISTORY_SEARCH_TYPE_PREFIX, true, 3, false, false},
+                    {L"ECHO 7 lower", HISTORY_SEARCH_TYPE_EXACT, false, LONG_MAX, false, false},
+                    {L"nothing", HISTORY_SEARCH_TYPE_CONTAINS, true, LONG_MAX, false, false}};
+    for (size_t i = 0; i < sizeof searches / sizeof *searches; i++) {
+        // Build the expected output from a sequential search.
+        wcstring expected;
+        long remaining = searches[i].max_items;
+        history_search_t searcher(hist, searches[i].term, searches[i].type,
+                                  searches[i].case_sensitive);
+        while (remaining-- > 0 && searcher.go_backwards()) {
+            const history_item_t item = searcher.current_item();
+            if (searches[i].show_time) {
+                const time_t seconds = item.timestamp();
+                struct tm timestamp;
+                wchar_t timestamp_string[101];
+                localtime_r(&seconds, &timestamp);
+                std::wcsftime(timestamp_string, 100, time_format, &timestamp);
+                expected.append(timestamp_string);
+            }
+            expected.append(item.str());
+            expected.push_back(searches[i].null_terminate ? L'\0' : L'\n');
+        }
+
+        io_streams_t streams;
+        do_test(hist.search(searches[i].type, wcstring_list_t(1, searches[i].term),
+                            searches[i].show_time ? time_format : NULL, searches[i].max_items,
+                            searches[i].case_sensitive, searches[i].null_terminate, streams));
+        if (streams.out.buffer() != expected) {
+            err(L"Parallel search for '%ls' wrote %lu characters, expected %lu", searches[i].term,
+                streams.out.buffer().size(), expected.size());
+        }
+    }
+
+    writer->clear();
+}
+
+void history_tests_t::test_history_scan_speed(void) {
+    say(L"Testing history scan speed");
+    const wcstring name = L"scan_speed_test";
+    wcstring path;
+    if (!path_get_data(path)) {
+        err(L"Failed to get data directory");
+        return;
+    }
+    path.append(L"/" + name + L"_history");
+
+    // Write a synthetic 100 MB history, remembering where each item starts.
+    const size_t target_size = 100 * 1024 * 1024;
+    std::vector<size_t> offsets;
+    std::string contents;
+    contents.reserve(target_size + 1024);
+    for (size_t i = 0; contents.size() < target_size; i++) {
+        offsets.push_back(contents.size());
+        char buff[256];
+        snprintf(buff, sizeof buff, "- cmd: git commit -m 'change number %lu'\n  when: %lu\n",
+                 (unsigned long)i, (unsigned long)(1500000000 + i));
+        contents.append(buff);
+        if (i % 3 == 0) {
+            snprintf(buff, sizeof buff, "  paths:\n    - src/file_%lu.cpp\n    - src/file.h\n",
+                     (unsigned long)i);
+            contents.append(buff);
+        }
+    }
+    FILE *f = wfopen(path, "w");
+    if (f == NULL || fwrite(contents.data(), contents.size(), 1, f) != 1) {
+        err(L"Couldn't write history file");
+        if (f) fclose(f);
+        return;
+    }
+    fclose(f);
+
+    history_t hist(name);
+    double start = timef();
+    hist.load_old_if_needed();
+    double elapsed = timef() - start;
+    say(L"Scanned %lu items (%lu MB) at %.0f MB/s", (unsigned long)hist.old_item_offsets.size(),
+        (unsigned long)(contents.size() >> 20), (contents.size() >> 20) / elapsed);
+
+    if (offsets.size() != hist.old_item_offsets.size() ||
+        !std::equal(offsets.begin(), offsets.end(), hist.old_item_offsets.begin())) {
+        err(L"Scanning found %lu items, expected %lu", hist.old_item_offsets.size(),
+            offsets.size());
+    }
+    const wcstring last = format_string(L"git commit -m 'change number %lu'",
+                                        (unsigned long)(offsets.size() - 1));
+    do_test(hist.item_at_index(1).str() == last);
+    hist.clear();
+}
+
 void history_tests_t::test_history_formats(void) {
     const wchar_t *name;
 
@@ -4096,12 +4911,179 @@ static void test_timezone_env_vars(void) {
     }
 }
 
+/// Return the exported value of the given variable, or "(missing)" if it is not exported.
+static std::string get_exported_var(const char *name) {
+    const size_t len = strlen(name);
+    for (const char *const *env = env_export_arr(); *env; env++) {
+        if (!strncmp(*env, name, len) && (*env)[len] == '=') return *env + len + 1;
+    }
+    return "(missing)";
+}
+
+static void check_exported_var(const char *name, const char *expected, long line) {
+    const std::string actual = get_exported_var(name);
+    if (actual != expected) {
+        err(L"line %ld: '%s' is exported as '%s', expected '%s'", line, name, actual.c_str(),
+            expected);
+    }
+}
+
+/// Verify that the export array follows variables as they are set, shadowed and erased.
+static void test_export_env_vars(void) {
+#define check_export(name, expected) check_exported_var(name, expected, __LINE__)
+    check_export("__fish_test_export", "(missing)");
+    env_set(L"__fish_test_export", L"global", ENV_GLOBAL | ENV_EXPORT);
+    check_export("__fish_test_export", "global");
+
+    // An unexported local hides the global.
+    env_push(true);
+    env_set(L"__fish_test_export", L"local", ENV_LOCAL);
+    check_export("__fish_test_export", "(missing)");
+    env_set(L"__fish_test_export", L"local", ENV_LOCAL | ENV_EXPORT);
+    check_export("__fish_test_export", "local");
+
+    // Exported locals are hidden from functions called from this one, but not from blocks.
+    env_set(L"__fish_test_export_local", L"a\x1e" "b", ENV_LOCAL | ENV_EXPORT);
+    env_push(false);
+    check_export("__fish_test_export_local", "a\x1e" "b");
+    env_push(true);
+    check_export("__fish_test_export", "global");
+    check_export("__fish_test_export_local", "(missing)");
+    env_pop();
+    check_export("__fish_test_export_local", "a\x1e" "b");
+    env_pop();
+    env_pop();
+    check_export("__fish_test_export", "global");
+    check_export("__fish_test_export_local", "(missing)");
+
+    // Colon delimited arrays are joined with colons.
+    env_set(L"__fish_test_export", L"a\x1e" "b", ENV_GLOBAL | ENV_EXPORT);
+    check_export("__fish_test_export", "a\x1e" "b");
+    env_set(L"MANPATH", L"a\x1e" "b", ENV_GLOBAL | ENV_EXPORT);
+    check_export("MANPATH", "a:b");
+
+    env_set(L"__fish_test_export", L"global", ENV_GLOBAL | ENV_UNEXPORT);
+    check_export("__fish_test_export", "(missing)");
+    env_set(L"__fish_test_export", L"global", ENV_GLOBAL | ENV_EXPORT);
+    env_remove(L"__fish_test_export", ENV_GLOBAL);
+    env_remove(L"MANPATH", ENV_GLOBAL);
+    check_export("__fish_test_export", "(missing)");
+    check_export("MANPATH", "(missing)");
+
+    // An exported universal is exported unless a global or local exports the name itself, however
+    // often the shadowing variable is set.
+    env_set(L"__fish_test_export", L"universal", ENV_UNIVERSAL | ENV_EXPORT);
+    check_export("__fish_test_export", "universal");
+    env_set(L"__fish_test_export", L"global", ENV_GLOBAL | ENV_UNEXPORT);
+    check_export("__fish_test_export", "universal");
+    env_set(L"__fish_test_export", L"global2", ENV_GLOBAL | ENV_UNEXPORT);
+    check_export("__fish_test_export", "universal");
+    env_set(L"__fish_test_export", L"global3", ENV_GLOBAL | ENV_EXPORT);
+    check_export("__fish_test_export", "global3");
+    env_remove(L"__fish_test_export", ENV_GLOBAL);
+    check_export("__fish_test_export", "universal");
+    env_remove(L"__fish_test_export", ENV_UNIVERSAL);
+    check_export("__fish_test_export", "(missing)");
+#undef check_export
+}
+
+/// Verify that arrays keep their elements when set and read as lists.
+static void test_list_env_vars(void) {
+    const wcstring_list_t vals = {L"a", L"", L"b c"};
+    env_set_list(L"__fish_test_list", vals, ENV_LOCAL);
+    env_list_ref_t got = env_get_list(L"__fish_test_list");
+    if (!got || *got != vals) {
+        err(L"List variable did not keep its elements");
+    }
+    if (env_get_string(L"__fish_test_list") != join_variable_array(vals)) {
+        err(L"List variable has the wrong string value");
+    }
+
+    // A string value is split into elements.
+    env_set(L"__fish_test_list", L"x" ARRAY_SEP_STR L"y", ENV_LOCAL);
+    got = env_get_list(L"__fish_test_list");
+    if (!got || got->size() != 2 || got->at(1) != L"y") {
+        err(L"String value was not split into elements");
+    }
+
+    // A zero element array exists, but has no value.
+    env_set_list(L"__fish_test_list", wcstring_list_t(), ENV_LOCAL);
+    if (env_get_list(L"__fish_test_list") || !env_get_string(L"__fish_test_list").missing() ||
+        !env_exist(L"__fish_test_list", ENV_LOCAL)) {
+        err(L"Zero element array is not empty");
+    }
+    env_remove(L"__fish_test_list", ENV_LOCAL);
+}
+
 /// Verify that setting special env vars have the expected effect on the current shell process.
 static void test_env_vars(void) {
     test_timezone_env_vars();
+    test_export_env_vars();
+    test_list_env_vars();
     // TODO: Add tests for the locale and ncurses vars.
 }
 
+/// Exercise many variables in many scopes, and time lookups through a deep stack of scopes.
+static void test_env_var_speed(void) {
+    say(L"Testing variable access speed");
+    const int scope_count = 64;
+    const int vars_per_scope = 50;
+
+    // A function scope with many nested blocks, all of which are searched for variables.
+    env_set(L"__fish_test_global", L"global", ENV_GLOBAL);
+    for (int i = 0; i < scope_count; i++) {
+        env_push(i == 0);
+        for (int j = 0; j < vars_per_scope; j++) {
+            env_set(format_string(L"__fish_test_local_%d", j), to_string(i).c_str(), ENV_LOCAL);
+        }
+    }
+
+    const int iterations = 100000;
+    double start = timef();
+    for (int i = 0; i < iterations; i++) {
+        env_get_string(L"__fish_test_local_1");
+    }
+    double local_time = timef() - start;
+
+    start = timef();
+    for (int i = 0; i < iterations; i++) {
+        env_get_string(L"__fish_test_global");
+    }
+    double global_time = timef() - start;
+
+    if (env_get_string(L"__fish_test_local_1") != to_string(scope_count - 1)) {
+        err(L"Local variable has the wrong value");
+    }
+    if (env_get_string(L"__fish_test_global") != L"global") {
+        err(L"Global variable has the wrong value");
+    }
+
+    // Erase every other variable in a new function scope, then make sure the rest are still found.
+    env_push(true);
+    for (int j = 0; j < vars_per_scope; j++) {
+        env_set(format_string(L"__fish_test_local_%d", j), L"shadowed", ENV_LOCAL);
+    }
+    for (int j = 0; j < vars_per_scope; j += 2) {
+        env_remove(format_string(L"__fish_test_local_%d", j), ENV_LOCAL);
+    }
+    for (int j = 0; j < vars_per_scope; j++) {
+        const wcstring name = format_string(L"__fish_test_local_%d", j);
+        bool exists = env_exist(name.c_str(), ENV_LOCAL);
+        if (exists != (j % 2 == 1)) {
+            err(L"Variable '%ls' should %ls", name.c_str(), exists ? L"not exist" : L"exist");
+        }
+    }
+    env_pop();
+
+    for (int i = 0; i < scope_count; i++) {
+        env_pop();
+    }
+    env_remove(L"__fish_test_global", ENV_GLOBAL);
+
+    say(L"    (%d lookups through %d scopes: %.02f msec local, %.02f msec global)", iterations,
+        scope_count, local_time * 1000.0, global_time * 1000.0);
+}
+
 static void test_illegal_command_exit_code(void) {
     say(L"Testing illegal command exit code");
 
@@ -4134,6 +5116,105 @@ static void test_illegal_command_exit_code(void) {
     }
 }
 
+static void test_function_call_speed(void) {
+    say(L"Testing function call overhead");
+    parser_t &parser = parser_t::principal_parser();
+    const io_chain_t empty_ios;
+    const wcstring body =
+        L"set -l count 0\n"
+        L"for i in a b c d\n"
+        L"    if test $i = c\n"
+        L"        set count $count $i\n"
+        L"    else if test $i = d\n"
+        L"        set -g __fish_test_call_speed_result $count[-1]\n"
+        L"    end\n"
+        L"end\n";
+
+    parser.eval(L"function __fish_test_call_speed\n" + body + L"end", empty_ios, TOP);
+    const parsed_tree_ref_t tree = function_get_parsed_definition(L"__fish_test_call_speed");
+    if (!tree) {
+        err(L"Function definition was not parsed when the function was added");
+        return;
+    }
+
+    env_remove(L"__fish_test_call_speed_result", ENV_GLOBAL);
+    parser.eval(L"__fish_test_call_speed", empty_ios, TOP);
+    if (env_get_string(L"__fish_test_call_speed_result") != L"c") {
+        err(L"Calling a function with a cached parse tree did not run its body");
+    }
+
+    // Compare executing the body from source, which re-parses it each time, with executing the
+    // cached tree.
+    const int iterations = 2000;
+    double start = timef();
+    for (int i = 0; i < iterations; i++) {
+        parser.eval(body, empty_ios, TOP);
+    }
+    double reparse_time = timef() - start;
+
+    start = timef();
+    for (int i = 0; i < iterations; i++) {
+        parser.eval(body, empty_ios, TOP, tree);
+    }
+    double cached_time = timef() - start;
+
+    say(L"    (%d calls: %.02f msec re-parsing, %.02f msec with cached tree)", iterations,
+        reparse_time * 1000.0, cached_time * 1000.0);
+    function_remove(L"__fish_test_call_speed");
+}
+
+/// Compare the ways of launching external commands, from a shell that uses 1 GB of memory. Forking
+/// copies the page tables for all of it, while posix_spawn and vfork share them with the child.
+static void test_spawn_speed(void) {
+    say(L"Testing spawn speed");
+    const size_t rss_size = 1024 * 1024 * 1024;
+    char *ballast = static_cast<char *>(malloc(rss_size));
+    if (ballast == NULL) {
+        say(L"    (could not allocate %lu MB, skipping)", (unsigned long)(rss_size >> 20));
+        return;
+    }
+    memset(ballast, 1, rss_size);
+
+    const bool saved_use_posix_spawn = g_use_posix_spawn;
+    const bool saved_use_vfork = g_use_vfork;
+    // Waiting for external commands relies on fish's SIGCHLD handler.
+    signal_set_handlers();
+
+    struct {
+        const wchar_t *name;
+        bool use_posix_spawn;
+        bool use_vfork;
+    } methods[] = {{L"fork", false, false},
+#if FISH_USE_POSIX_SPAWN
+                   {L"posix_spawn", true, false},
+#endif
+#if FISH_USE_VFORK
+                   {L"vfork", false, true},
+#endif
+    };
+
+    parser_t &parser = parser_t::principal_parser();
+    const int iterations = 50;
+    for (size_t i = 0; i < sizeof methods / sizeof *methods; i++) {
+        g_use_posix_spawn = methods[i].use_posix_spawn;
+        g_use_vfork = methods[i].use_vfork;
+        int fork_count = g_fork_count;
+        double start = timef();
+        for (int j = 0; j < iterations; j++) {
+            parser.eval(L"/bin/true", io_chain_t(), TOP);
+        }
+        double elapsed = timef() - start;
+        if (g_fork_count - fork_count != iterations || proc_get_last_status() != 0) {
+            err(L"Running /bin/true with %ls failed", methods[i].name);
+        }
+        say(L"    (%ls: %.03f msec per command)", methods[i].name, elapsed * 1000.0 / iterations);
+    }
+
+    g_use_posix_spawn = saved_use_posix_spawn;
+    g_use_vfork = saved_use_vfork;
+    free(ballast);
+}
+
 /// Main test.
 int main(int argc, char **argv) {
     UNUSED(argc);
@@ -4197,6 +5278,10 @@ int main(int argc, char **argv) {
     if (should_test_function("tok")) test_tokenizer();
     if (should_test_function("iothread")) test_iothread();
     if (should_test_function("parser")) test_parser();
+    if (should_test_function("cmdsubst_buffer")) test_cmdsubst_buffer();
+    if (should_test_function("concurrent_cmdsubst")) test_concurrent_cmdsubst();
+    if (should_test_function("job_control_forks")) test_job_control_forks();
+    if (should_test_function("builtin_output")) test_builtin_output();
     if (should_test_function("cancellation")) test_cancellation();
     if (should_test_function("indents")) test_indents();
     if (should_test_function("utils")) test_utils();
@@ -4212,6 +5297,7 @@ int main(int argc, char **argv) {
     if (should_test_function("pager_layout")) test_pager_layout();
     if (should_test_function("word_motion")) test_word_motion();
     if (should_test_function("is_potential_path")) test_is_potential_path();
+    if (should_test_function("path_statuses")) test_path_statuses();
     if (should_test_function("colors")) test_colors();
     if (should_test_function("complete")) test_complete();
     if (should_test_function("input")) test_input();
@@ -4227,14 +5313,34 @@ int main(int argc, char **argv) {
     if (should_test_function("history_merge")) history_tests_t::test_history_merge();
     if (should_test_function("history_races")) history_tests_t::test_history_races();
     if (should_test_function("history_formats")) history_tests_t::test_history_formats();
+    if (should_test_function("history_index")) history_tests_t::test_history_index();
+    if (should_test_function("history_incorporate")) history_tests_t::test_history_incorporate();
+    if (should_test_function("history_item_encoding")) {
+        history_tests_t::test_history_item_encoding();
+    }
+    if (should_test_function("history_vacuum")) history_tests_t::test_history_vacuum();
+    if (should_test_function("history_item_cache")) history_tests_t::test_history_item_cache();
+    if (should_test_function("history_time_range")) history_tests_t::test_history_time_range();
+    if (should_test_function("history_batching")) history_tests_t::test_history_batching();
+    if (should_test_function("history_search_index")) history_tests_t::test_history_search_index();
+    if (should_test_function("history_parallel_search")) {
+        history_tests_t::test_history_parallel_search();
+    }
+    if (should_test_function("history_scan_speed", false)) {
+        history_tests_t::test_history_scan_speed();  // expensive
+    }
     if (should_test_function("string")) test_string();
     if (should_test_function("env_vars")) test_env_vars();
+    if (should_test_function("env_var_speed")) test_env_var_speed();
     if (should_test_function("illegal_command_exit_code")) test_illegal_command_exit_code();
+    if (should_test_function("function_call_speed")) test_function_call_speed();
+    if (should_test_function("spawn_speed", false)) test_spawn_speed();  // expensive
     // history_tests_t::test_history_speed();
 
     say(L"Encountered %d errors in low-level tests", err_count);
     if (s_test_run_count == 0) say(L"*** No Tests Were Actually Run! ***");
 
+    history_destroy();
     reader_destroy();
     builtin_destroy();
     event_destroy();
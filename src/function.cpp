@@ -23,6 +23,7 @@
 #include "fallback.h"  // IWYU pragma: keep
 #include "function.h"
 #include "intern.h"
+#include "parse_tree.h"
 #include "parser_keywords.h"
 #include "reader.h"
 #include "wutil.h"  // IWYU pragma: keep
@@ -126,9 +127,19 @@ static std::map<wcstring, env_var_t> snapshot_vars(const wcstring_list_t &vars)
     return result;
 }
 
+/// Parse a function definition once, so that the tree can be shared by every call of the function.
+static parsed_tree_ref_t parse_definition(const wcstring &definition) {
+    parse_node_tree_t tree;
+    if (!parse_tree_from_string(definition, parse_flag_none, &tree, NULL)) {
+        return parsed_tree_ref_t();
+    }
+    return std::make_shared<const parse_node_tree_t>(std::move(tree));
+}
+
 function_info_t::function_info_t(const function_data_t &data, const wchar_t *filename,
                                  int def_offset, bool autoload)
     : definition(data.definition),
+      parsed_definition(parse_definition(definition)),
       description(data.description),
       definition_file(intern(filename)),
       definition_offset(def_offset),
@@ -140,6 +151,7 @@ function_info_t::function_info_t(const function_data_t &data, const wchar_t *fil
 function_info_t::function_info_t(const function_info_t &data, const wchar_t *filename,
                                  int def_offset, bool autoload)
     : definition(data.definition),
+      parsed_definition(data.parsed_definition),
       description(data.description),
       definition_file(intern(filename)),
       definition_offset(def_offset),
@@ -238,6 +250,12 @@ bool function_get_definition(const wcstring &name, wcstring *out_definition) {
     return func != NULL;
 }
 
+parsed_tree_ref_t function_get_parsed_definition(const wcstring &name) {
+    scoped_lock locker(functions_lock);
+    const function_info_t *func = function_get(name);
+    return func ? func->parsed_definition : parsed_tree_ref_t();
+}
+
 wcstring_list_t function_get_named_arguments(const wcstring &name) {
     scoped_lock locker(functions_lock);
     const function_info_t *func = function_get(name);
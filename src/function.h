@@ -10,6 +10,7 @@
 #include "common.h"
 #include "env.h"
 #include "event.h"
+#include "parse_tree.h"
 
 class parser_t;
 
@@ -38,6 +39,9 @@ class function_info_t {
    public:
     /// Function definition.
     const wcstring definition;
+    /// The definition parsed into a tree, so that calls do not need to re-parse it. This is empty
+    /// if the definition could not be parsed.
+    const parsed_tree_ref_t parsed_definition;
     /// Function description. Only the description may be changed after the function is created.
     wcstring description;
     /// File where this function was defined (intern'd string).
@@ -78,6 +82,11 @@ void function_remove(const wcstring &name);
 /// successful, false if no function with the given name exists.
 bool function_get_definition(const wcstring &name, wcstring *out_definition);
 
+/// Returns the parsed definition of the function with the name \c name, which is shared between
+/// all calls of the function. Returns an empty reference if no such function exists, or if its
+/// definition could not be parsed.
+parsed_tree_ref_t function_get_parsed_definition(const wcstring &name);
+
 /// Returns by reference the description of the function with the name \c name. Returns true if the
 /// function exists and has a nonempty description, false if it does not.
 bool function_get_desc(const wcstring &name, wcstring *out_desc);
@@ -34,6 +34,11 @@
 
 #define CURSOR_POSITION_INVALID ((size_t)(-1))
 
+/// How long validating an autosuggestion waits for the paths its history item requires, in
+/// milliseconds. A path that takes longer, e.g. on a slow network filesystem, counts as missing for
+/// now; its check goes on in the background, so the next keystroke will likely find it cached.
+#define AUTOSUGGEST_PATH_TIMEOUT_MSEC 100
+
 /// Number of elements in the highlight_var array.
 #define VAR_COUNT (sizeof(highlight_var) / sizeof(wchar_t *))
 
@@ -152,8 +157,7 @@ bool is_potential_path(const wcstring &potential_path_fragment, const wcstring_l
         // If we end with a slash, then it must be a directory.
         bool must_be_full_dir = abs_path.at(abs_path.size() - 1) == L'/';
         if (must_be_full_dir) {
-            struct stat buf;
-            if (0 == wstat(abs_path, &buf) && S_ISDIR(buf.st_mode)) {
+            if (path_get_status(abs_path) == PATH_STATUS_DIRECTORY) {
                 result = true;
             }
         } else {
@@ -164,7 +168,8 @@ bool is_potential_path(const wcstring &potential_path_fragment, const wcstring_l
             if (dir_name == L"/" && filename_fragment == L"/") {
                 // cd ///.... No autosuggestion.
                 result = true;
-            } else if ((dir = wopendir(dir_name))) {
+            } else if (path_get_status(dir_name) == PATH_STATUS_DIRECTORY &&
+                       (dir = wopendir(dir_name))) {
                 // Check if we're case insensitive.
                 const bool do_case_insensitive =
                     fs_is_case_insensitive(dir_name, dirfd(dir), case_sensitivity_cache);
@@ -371,7 +376,7 @@ bool autosuggest_validate_from_history(const history_item_t &item,
 
     if (cmd_ok) {
         const path_list_t &paths = item.get_required_paths();
-        suggestionOK = all_paths_are_valid(paths, working_directory);
+        suggestionOK = all_paths_are_valid(paths, working_directory, AUTOSUGGEST_PATH_TIMEOUT_MSEC);
     }
 
     return suggestionOK;
@@ -17,12 +17,21 @@
 #include <unistd.h>
 #include <wchar.h>
 #include <wctype.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include <algorithm>
 #include <atomic>
 #include <cwchar>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <numeric>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "common.h"
 #include "env.h"
@@ -51,6 +60,13 @@
 // When we rewrite the history, the number of items we keep.
 #define HISTORY_SAVE_MAX (1024 * 256)
 
+// The search index is only built for histories with at least this many old items. Smaller ones are
+// searched quickly enough item by item.
+#define HISTORY_SEARCH_INDEX_MIN_ITEMS 10000
+
+// How many items may be appended to the history file before they are added to the search index.
+#define HISTORY_SEARCH_INDEX_EXTEND_ITEMS 256
+
 // Default buffer size for flushing to the history file.
 #define HISTORY_OUTPUT_BUFFER_SIZE (64 * 1024)
 
@@ -62,6 +78,12 @@ static constexpr int history_file_mode = 0644;
 // the file and taking the lock
 static constexpr int max_save_tries = 1024;
 
+// How many new items may wait before they are appended to the history file, and for how many
+// milliseconds (0 for no limit). By default, every item is appended as soon as it is added. See
+// update_history_flush_policy().
+static std::atomic<size_t> s_flush_max_items(1);
+static std::atomic<long> s_flush_max_delay_ms(0);
+
 namespace {
 
 /// Helper class for certain output. This is basically a string that allows us to ensure we only
@@ -154,10 +176,13 @@ class history_lru_item_t {
     wcstring text;
     time_t timestamp;
     path_list_t required_paths;
-    explicit history_lru_item_t(const history_item_t &item)
+    // The offset of the item in the file being rewritten, or -1 if it is new.
+    size_t source_offset;
+    history_lru_item_t(const history_item_t &item, size_t offset)
         : text(item.str()),
           timestamp(item.timestamp()),
-          required_paths(item.get_required_paths()) {}
+          required_paths(item.get_required_paths()),
+          source_offset(offset) {}
 };
 
 class history_lru_cache_t : public lru_cache_t<history_lru_cache_t, history_lru_item_t> {
@@ -166,8 +191,11 @@ class history_lru_cache_t : public lru_cache_t<history_lru_cache_t, history_lru_
    public:
     using super::super;
 
-    /// Function to add a history item.
-    void add_item(const history_item_t &item) {
+    /// Function to add a history item. source_offset is its offset in the file being rewritten, or
+    /// -1. If aliases is not NULL, the offsets of earlier items with the same contents are added
+    /// to it, paired with the offset of the item that replaces them.
+    void add_item(const history_item_t &item, size_t source_offset = (size_t)-1,
+                  std::vector<std::pair<size_t, size_t>> *aliases = NULL) {
         // Skip empty items.
         if (item.empty()) return;
 
@@ -176,10 +204,16 @@ class history_lru_cache_t : public lru_cache_t<history_lru_cache_t, history_lru_
         wcstring key = item.str();
         history_lru_item_t *node = this->get(key);
         if (node == NULL) {
-            this->insert(std::move(key), history_lru_item_t(item));
+            this->insert(std::move(key), history_lru_item_t(item, source_offset));
         } else {
             node->timestamp = std::max(node->timestamp, item.timestamp());
             // What to do about paths here? Let's just ignore them.
+            if (source_offset != (size_t)-1) {
+                if (aliases && node->source_offset != (size_t)-1) {
+                    aliases->push_back(std::make_pair(node->source_offset, source_offset));
+                }
+                node->source_offset = source_offset;
+            }
         }
     }
 };
@@ -192,12 +226,37 @@ class history_collection_t {
    public:
     history_t &get_creating(const wcstring &name);
     void save();
+    // The earliest next_flush_time of the histories, or 0.
+    double next_flush_time();
+    void save_due();
 };
 
 }  // anonymous namespace
 
 static history_collection_t histories;
 
+/// How many decoded old items we keep around. This covers a lot of up-arrow presses.
+static constexpr size_t history_item_cache_size = 512;
+
+/// Cache of decoded old items, keyed by their offset in the mapped history file.
+class history_item_cache_t : public lru_cache_t<history_item_cache_t, history_item_t, size_t> {
+    typedef lru_cache_t<history_item_cache_t, history_item_t, size_t> super;
+
+   public:
+    using super::super;
+};
+
+/// Bounds on the timestamps of old items, indexed like old_item_offsets. The file is only roughly
+/// in timestamp order, so we keep the latest timestamp up to each item and the earliest from each
+/// item on. Both of these only grow, so binary search finds the span of items that can be in a
+/// range.
+class history_time_index_t {
+   public:
+    uint64_t generation = 0;
+    std::vector<time_t> latest_up_to;
+    std::vector<time_t> earliest_from;
+};
+
 static wcstring history_filename(const wcstring &name, const wcstring &suffix);
 
 /// Replaces newlines with a literal backslash followed by an n, and replaces backslashes with two
@@ -414,13 +473,102 @@ static history_item_t decode_item(const char *base, size_t len, history_file_typ
     return history_item_t(L"");
 }
 
+/// Encode a string into the compact form of history_item_t::contents. This is UTF-8 without the
+/// limits of RFC 3629: surrogates and values past U+10FFFF are encoded like any other, with up to
+/// six bytes, or seven for values that don't fit in 31 bits. So unlike wcs2string it round-trips
+/// every string, whatever the locale.
+static void encode_history_string(const wcstring &str, std::string *out) {
+    out->clear();
+    out->reserve(str.size());
+    for (wchar_t wc : str) {
+        uint32_t c = (uint32_t)wc;
+        if (c < 0x80) {
+            out->push_back((char)c);
+            continue;
+        }
+        int trailing;
+        unsigned char lead;
+        if (c < 0x800) {
+            trailing = 1, lead = 0xC0;
+        } else if (c < 0x10000) {
+            trailing = 2, lead = 0xE0;
+        } else if (c < 0x200000) {
+            trailing = 3, lead = 0xF0;
+        } else if (c < 0x4000000) {
+            trailing = 4, lead = 0xF8;
+        } else if (c < 0x80000000) {
+            trailing = 5, lead = 0xFC;
+        } else {
+            trailing = 6, lead = 0xFE;
+        }
+        out->push_back((char)(lead | (trailing < 6 ? c >> (6 * trailing) : 0)));
+        while (trailing--) {
+            out->push_back((char)(0x80 | ((c >> (6 * trailing)) & 0x3F)));
+        }
+    }
+}
+
+/// Decode the character of the compact form produced by encode_history_string at *cursor, and
+/// advance the cursor past it.
+static inline wchar_t decode_history_char(const unsigned char **cursor) {
+    unsigned char lead = *(*cursor)++;
+    uint32_t c;
+    int trailing;
+    if (lead < 0x80) {
+        return (wchar_t)lead;
+    } else if (lead < 0xE0) {
+        c = lead & 0x1F, trailing = 1;
+    } else if (lead < 0xF0) {
+        c = lead & 0x0F, trailing = 2;
+    } else if (lead < 0xF8) {
+        c = lead & 0x07, trailing = 3;
+    } else if (lead < 0xFC) {
+        c = lead & 0x03, trailing = 4;
+    } else if (lead < 0xFE) {
+        c = lead & 0x01, trailing = 5;
+    } else {
+        c = 0, trailing = 6;
+    }
+    // We only decode what we encoded, so the continuation bytes are all there.
+    while (trailing--) {
+        c = (c << 6) | (*(*cursor)++ & 0x3F);
+    }
+    return (wchar_t)c;
+}
+
+/// Decode the compact form produced by encode_history_string, optionally lowercasing as we go.
+static wcstring decode_history_string(const std::string &str, bool lowercase) {
+    wcstring result;
+    result.reserve(str.size());
+    const unsigned char *cursor = (const unsigned char *)str.data();
+    const unsigned char *const end = cursor + str.size();
+    while (cursor < end) {
+        wchar_t wc = decode_history_char(&cursor);
+        result.push_back(lowercase ? towlower(wc) : wc);
+    }
+    return result;
+}
+
+/// Returns whether the compact form str, starting at byte offset start, begins with term, ignoring
+/// case. If whole is set, term must also take up the rest of str. The characters are decoded and
+/// folded one at a time, so nothing is allocated.
+static bool history_string_matches_icase(const std::string &str, size_t start, const wcstring &term,
+                                         bool whole) {
+    const unsigned char *cursor = (const unsigned char *)str.data() + start;
+    const unsigned char *const end = (const unsigned char *)str.data() + str.size();
+    for (wchar_t wc : term) {
+        if (cursor == end || towlower(decode_history_char(&cursor)) != towlower(wc)) return false;
+    }
+    return !whole || cursor == end;
+}
+
 /// We can merge two items if they are the same command. We use the more recent timestamp, more
 /// recent identifier, and the longer list of required paths.
 bool history_item_t::merge(const history_item_t &item) {
     bool result = false;
     if (this->contents == item.contents) {
         this->creation_timestamp = std::max(this->creation_timestamp, item.creation_timestamp);
-        if (this->required_paths.size() < item.required_paths.size()) {
+        if (this->get_required_paths().size() < item.get_required_paths().size()) {
             this->required_paths = item.required_paths;
         }
         if (this->identifier < item.identifier) {
@@ -431,19 +579,26 @@ bool history_item_t::merge(const history_item_t &item) {
     return result;
 }
 
-#if 0
-history_item_t::history_item_t(const wcstring &str)
-    : contents(str), contents_lower(L""), creation_timestamp(time(NULL)), identifier(0) {
-        for (wcstring::const_iterator it = str.begin(); it != str.end(); ++it) {
-                contents_lower.push_back(towlower(*it));
-        }
-    }
-#endif
-
 history_item_t::history_item_t(const wcstring &str, time_t when, history_identifier_t ident)
-    : contents(str), contents_lower(L""), creation_timestamp(when), identifier(ident) {
-    for (wcstring::const_iterator it = str.begin(); it != str.end(); ++it) {
-        contents_lower.push_back(towlower(*it));
+    : creation_timestamp(when), identifier(ident) {
+    encode_history_string(str, &contents);
+    contents.shrink_to_fit();
+}
+
+wcstring history_item_t::str() const { return decode_history_string(contents, false); }
+
+wcstring history_item_t::str_lower() const { return decode_history_string(contents, true); }
+
+const path_list_t &history_item_t::get_required_paths() const {
+    static const path_list_t no_paths;
+    return required_paths ? *required_paths : no_paths;
+}
+
+void history_item_t::set_required_paths(path_list_t paths) {
+    if (paths.empty()) {
+        required_paths.reset();
+    } else {
+        required_paths = std::make_shared<const path_list_t>(std::move(paths));
     }
 }
 
@@ -455,25 +610,31 @@ bool history_item_t::matches_search(const wcstring &term, enum history_search_ty
     // Too, we consider equal strings to match a prefix search, so that autosuggest will allow
     // suggesting what you've typed.
     if (case_sensitive) {
-        if (type == HISTORY_SEARCH_TYPE_EXACT || term.size() == contents.size()) {
-            return term == contents;
+        // Our encoding is self-synchronizing like UTF-8, so we can match the encoded strings.
+        std::string eterm;
+        encode_history_string(term, &eterm);
+        if (type == HISTORY_SEARCH_TYPE_EXACT || eterm.size() == contents.size()) {
+            return eterm == contents;
         } else if (type == HISTORY_SEARCH_TYPE_CONTAINS) {
-            return contents.find(term) != wcstring::npos;
+            return contents.find(eterm) != std::string::npos;
         } else if (type == HISTORY_SEARCH_TYPE_PREFIX) {
-            return string_prefixes_string(term, contents);
+            return contents.size() >= eterm.size() && contents.compare(0, eterm.size(), eterm) == 0;
         }
     } else {
-        wcstring lterm(L"");
-        for (wcstring::const_iterator it = term.begin(); it != term.end(); ++it) {
-            lterm.push_back(towlower(*it));
-        }
-
-        if (type == HISTORY_SEARCH_TYPE_EXACT || lterm.size() == contents.size()) {
-            return lterm == contents_lower;
+        if (type == HISTORY_SEARCH_TYPE_EXACT) {
+            return history_string_matches_icase(contents, 0, term, true);
         } else if (type == HISTORY_SEARCH_TYPE_CONTAINS) {
-            return contents_lower.find(lterm) != wcstring::npos;
+            if (term.empty()) return true;
+            for (size_t start = 0; start < contents.size(); start++) {
+                // Only try positions where a character starts.
+                if ((contents[start] & 0xC0) != 0x80 &&
+                    history_string_matches_icase(contents, start, term, false)) {
+                    return true;
+                }
+            }
+            return false;
         } else if (type == HISTORY_SEARCH_TYPE_PREFIX) {
-            return string_prefixes_string(lterm, contents_lower);
+            return history_string_matches_icase(contents, 0, term, false);
         }
     }
     DIE("unexpected history_search_type_t value");
@@ -528,41 +689,80 @@ static bool parse_timestamp(const char *str, time_t *out_when) {
     return false;
 }
 
-/// Returns a pointer to the start of the next line, or NULL. The next line must itself end with a
-/// newline. Note that the string is not null terminated.
-static const char *next_line(const char *start, size_t length) {
-    // Handle the hopeless case.
-    if (length < 1) return NULL;
-
-    // Get a pointer to the end, that we must not pass.
-    const char *const end = start + length;
-
-    // Skip past the next newline.
-    const char *nextline = (const char *)memchr(start, '\n', length);
-    if (!nextline || nextline >= end) {
-        return NULL;
-    }
-    // Skip past the newline character itself.
-    if (++nextline >= end) {
-        return NULL;
-    }
-
-    // Make sure this new line is itself "newline terminated". If it's not, return NULL.
-    const char *next_newline = (const char *)memchr(nextline, '\n', end - nextline);
-    if (!next_newline) {
-        return NULL;
-    }
-
-    return nextline;
+/// Returns the timestamp of the fish 2.0 item at the start of base without decoding it, or 0 if it
+/// has none. Like parse_timestamp, this relies on the item ending with a newline.
+static time_t timestamp_of_item_fish_2_0(const char *base, size_t len) {
+    const char *const end = base + len;
+    const char *line = (const char *)memchr(base, '\n', len);
+    while (line != NULL && ++line < end && *line == ' ') {
+        time_t timestamp;
+        if (parse_timestamp(line, &timestamp)) return timestamp;
+        line = (const char *)memchr(line, '\n', end - line);
+    }
+    return 0;
+}
+
+/// Returns the offset of the first line at or after the line starting at cursor that does not
+/// start with a space, or of the last line if they all do. Lines that start with a space are in the
+/// interior of an item, so this skips to the start of the next item.
+static size_t skip_interior_lines_scalar(const char *begin, size_t length, size_t cursor) {
+    while (cursor < length && begin[cursor] == ' ') {
+        const char *newline = (const char *)memchr(begin + cursor, '\n', length - cursor);
+        if (newline == NULL) break;
+        cursor = newline - begin + 1;
+    }
+    return cursor;
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+/// The same as skip_interior_lines_scalar, but looks at a block of bytes at a time: a newline ends
+/// the interior lines unless it is followed by a space, so compare the block against '\n' and the
+/// block one byte further against ' '.
+static size_t skip_interior_lines(const char *begin, size_t length, size_t cursor) {
+    if (cursor >= length || begin[cursor] != ' ') return cursor;
+    size_t line_start = cursor;
+#ifdef __AVX2__
+    typedef __m256i block_t;
+    const size_t block_size = 32;
+    const block_t newlines = _mm256_set1_epi8('\n'), spaces = _mm256_set1_epi8(' ');
+#define LOAD_BLOCK(p) _mm256_loadu_si256((const block_t *)(p))
+#define BLOCK_MASK(a, b) (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8((a), (b)))
+#else
+    typedef __m128i block_t;
+    const size_t block_size = 16;
+    const block_t newlines = _mm_set1_epi8('\n'), spaces = _mm_set1_epi8(' ');
+#define LOAD_BLOCK(p) _mm_loadu_si128((const block_t *)(p))
+#define BLOCK_MASK(a, b) (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8((a), (b)))
+#endif
+    // The byte after the block has to be readable too.
+    while (cursor + block_size < length) {
+        const uint32_t newline_mask = BLOCK_MASK(LOAD_BLOCK(begin + cursor), newlines);
+        const uint32_t space_mask = BLOCK_MASK(LOAD_BLOCK(begin + cursor + 1), spaces);
+        const uint32_t item_mask = newline_mask & ~space_mask;
+        if (item_mask) return cursor + __builtin_ctz(item_mask) + 1;
+        if (newline_mask) line_start = cursor + (31 - __builtin_clz(newline_mask)) + 1;
+        cursor += block_size;
+    }
+#undef LOAD_BLOCK
+#undef BLOCK_MASK
+    // Finish the last block a line at a time, starting with the line the cursor is in.
+    return skip_interior_lines_scalar(begin, length, line_start);
+}
+#else
+static size_t skip_interior_lines(const char *begin, size_t length, size_t cursor) {
+    return skip_interior_lines_scalar(begin, length, cursor);
 }
+#endif
 
 /// Support for iteratively locating the offsets of history items.
 /// Pass the address and length of a mapped region.
 /// Pass a pointer to a cursor size_t, initially 0.
 /// If custoff_timestamp is nonzero, skip items created at or after that timestamp.
+/// If out_timestamp is not null, set it to the timestamp of the returned item, or 0 if it has none.
 /// Returns (size_t)-1 when done.
 static size_t offset_of_next_item_fish_2_0(const char *begin, size_t mmap_length,
-                                           size_t *inout_cursor, time_t cutoff_timestamp) {
+                                           size_t *inout_cursor, time_t cutoff_timestamp,
+                                           time_t *out_timestamp = NULL) {
     size_t cursor = *inout_cursor;
     size_t result = (size_t)-1;
     while (cursor < mmap_length) {
@@ -572,8 +772,10 @@ static size_t offset_of_next_item_fish_2_0(const char *begin, size_t mmap_length
         const char *a_newline = (const char *)memchr(line_start, '\n', mmap_length - cursor);
         if (a_newline == NULL) break;
 
-        // Advance the cursor past this line. +1 is for the newline.
-        cursor = a_newline - begin + 1;
+        // Advance the cursor past this line, and past the interior lines that follow it, which all
+        // have a leading space. They are complete up to the cursor.
+        const char *const interior_start = a_newline + 1;
+        cursor = skip_interior_lines(begin, mmap_length, interior_start - begin);
 
         // Skip lines with a leading space, since these are in the interior of one of our items.
         if (line_start[0] == ' ') continue;
@@ -606,44 +808,38 @@ static size_t offset_of_next_item_fish_2_0(const char *begin, size_t mmap_length
         }
 
         // At this point, we know line_start is at the beginning of an item. But maybe we want to
-        // skip this item because of timestamps. A 0 cutoff means we don't care; if we do care, then
-        // try parsing out a timestamp.
-        if (cutoff_timestamp != 0) {
+        // skip this item because of timestamps. A 0 cutoff means we don't care; if we do care, or
+        // the caller wants the timestamp, then try parsing out a timestamp.
+        time_t item_timestamp = 0;
+        if (cutoff_timestamp != 0 || out_timestamp != NULL) {
             // Hackish fast way to skip items created after our timestamp. This is the mechanism by
             // which we avoid "seeing" commands from other sessions that started after we started.
             // We try hard to ensure that our items are sorted by their timestamps, so in theory we
             // could just break, but I don't think that works well if (for example) the clock
             // changes. So we'll read all subsequent items.
-            const char *const end = begin + mmap_length;
-
-            // Walk over lines that we think are interior. These lines are not null terminated, but
-            // are guaranteed to contain a newline.
+            //
+            // Walk over the interior lines. These lines are not null terminated, but are
+            // guaranteed to contain a newline. The timestamp is normally on the first one.
+            const char *const interior_end = begin + cursor;
             bool has_timestamp = false;
             time_t timestamp = 0;
-            const char *interior_line;
-
-            for (interior_line = next_line(line_start, end - line_start);
-                 interior_line != NULL && !has_timestamp;
-                 interior_line = next_line(interior_line, end - interior_line)) {
-                // If the first character is not a space, it's not an interior line, so we're done.
-                if (interior_line[0] != ' ') break;
-
-                // Hackish optimization: since we just stepped over some interior line, update the
-                // cursor so we don't have to look at these lines next time.
-                cursor = interior_line - begin;
-
-                // Try parsing a timestamp from this line. If we succeed, the loop will break.
+            const char *interior_line = interior_start;
+            while (interior_line < interior_end && !has_timestamp) {
                 has_timestamp = parse_timestamp(interior_line, &timestamp);
+                interior_line =
+                    (const char *)memchr(interior_line, '\n', interior_end - interior_line) + 1;
             }
 
             // Skip this item if the timestamp is past our cutoff.
-            if (has_timestamp && timestamp > cutoff_timestamp) {
+            if (cutoff_timestamp != 0 && has_timestamp && timestamp > cutoff_timestamp) {
                 continue;
             }
+            if (has_timestamp) item_timestamp = timestamp;
         }
 
         // We made it through the gauntlet.
         result = line_start - begin;
+        if (out_timestamp != NULL) *out_timestamp = item_timestamp;
         break;  //!OCLINT(avoid branching statement as last in loop)
     }
 
@@ -719,18 +915,39 @@ history_t::history_t(const wcstring &pname)
       first_unwritten_new_item_index(0),
       has_pending_item(false),
       disable_automatic_save_counter(0),
+      oldest_unwritten_item_time(0),
+      flushes_saved(0),
       mmap_start(NULL),
       mmap_length(0),
       mmap_type(history_file_type_t(-1)),
       mmap_file_id(kInvalidFileID),
       boundary_timestamp(time(NULL)),
       countdown_to_vacuum(-1),
+      vacuum_in_progress(false),
+      old_items_scanned_length(0),
       loaded_old(false),
+      item_cache(new history_item_cache_t(history_item_cache_size)),
+      item_cache_hits(0),
+      item_cache_misses(0),
+      old_items_generation(0),
+      search_index_building(false),
+      search_index_abandoned(false),
       chaos_mode(false) {
     pthread_mutex_init(&lock, NULL);
 }
 
-history_t::~history_t() { pthread_mutex_destroy(&lock); }
+history_t::~history_t() {
+    // Don't pull the history out from under the thread building the search index, or the one
+    // vacuuming the file.
+    bool building;
+    {
+        scoped_lock locker(lock);
+        search_index_abandoned = true;
+        building = search_index_building || vacuum_in_progress;
+    }
+    if (building) iothread_drain_all();
+    pthread_mutex_destroy(&lock);
+}
 
 void history_t::add(const history_item_t &item, bool pending) {
     scoped_lock locker(lock);
@@ -742,6 +959,9 @@ void history_t::add(const history_item_t &item, bool pending) {
         this->has_pending_item = false;
     } else {
         // We have to add a new item.
+        if (first_unwritten_new_item_index >= new_items.size()) {
+            oldest_unwritten_item_time = timef();
+        }
         new_items.push_back(item);
         this->has_pending_item = pending;
         save_internal_unless_disabled();
@@ -757,6 +977,12 @@ void history_t::save_internal_unless_disabled() {
         return;
     }
 
+    // Let the new items pile up if the flush policy allows, so they are appended in one go.
+    if (deleted_items.empty() && can_defer_save()) {
+        flushes_saved++;
+        return;
+    }
+
     // We may or may not vacuum. We try to vacuum every kVacuumFrequency items, but start the
     // countdown at a random number so that even if the user never runs more than 25 commands, we'll
     // eventually vacuum.  If countdown_to_vacuum is -1, it means we haven't yet picked a value for
@@ -775,16 +1001,47 @@ void history_t::save_internal_unless_disabled() {
         vacuum = true;
     }
 
-    // This might be a good candidate for moving to a background thread.
+    // Vacuuming rewrites the whole file, so do that in the background (which is started from the
+    // main thread), after appending the new items as usual.
+    const bool background_vacuum = vacuum && is_main_thread();
     time_profiler_t profiler(vacuum ? "save_internal vacuum"       //!OCLINT(unused var)
                                     : "save_internal no vacuum");  //!OCLINT(side-effect)
-    this->save_internal(vacuum);
+    this->save_internal(vacuum && !background_vacuum);
+    if (background_vacuum && deleted_items.empty() &&
+        first_unwritten_new_item_index == new_items.size()) {
+        this->vacuum_in_background();
+    }
 
     // Update our countdown.
     assert(countdown_to_vacuum > 0);
     countdown_to_vacuum--;
 }
 
+bool history_t::can_defer_save() const {
+    ASSERT_IS_LOCKED(lock);
+    size_t unwritten = new_items.size() - first_unwritten_new_item_index;
+    if (unwritten >= s_flush_max_items) return false;
+    long max_delay_ms = s_flush_max_delay_ms;
+    return max_delay_ms == 0 || (timef() - oldest_unwritten_item_time) * 1000 < max_delay_ms;
+}
+
+double history_t::next_flush_time() {
+    scoped_lock locker(lock);
+    long max_delay_ms = s_flush_max_delay_ms;
+    if (max_delay_ms == 0 || first_unwritten_new_item_index >= new_items.size() ||
+        disable_automatic_save_counter > 0) {
+        return 0;
+    }
+    return oldest_unwritten_item_time + max_delay_ms / 1000.0;
+}
+
+void history_t::save_if_due() {
+    scoped_lock locker(lock);
+    if (first_unwritten_new_item_index < new_items.size() && !can_defer_save()) {
+        save_internal_unless_disabled();
+    }
+}
+
 void history_t::add(const wcstring &str, history_identifier_t ident, bool pending) {
     time_t when = time(NULL);
     // Big hack: do not allow timestamps equal to our boundary date. This is because we include
@@ -833,16 +1090,23 @@ void history_t::set_valid_file_paths(const wcstring_list_t &valid_file_paths,
     for (history_item_list_t::reverse_iterator iter = new_items.rbegin(); iter != new_items.rend();
          ++iter) {
         if (iter->identifier == ident) {  // found it
-            iter->required_paths = valid_file_paths;
+            iter->set_required_paths(valid_file_paths);
             break;
         }
     }
 }
 
 void history_t::get_string_representation(wcstring *result, const wcstring &separator) {
-    scoped_lock locker(lock);
+    wcstring_list_t items;
+    get_unique_items(&items);
+    for (size_t i = 0; i < items.size(); i++) {
+        if (i > 0) result->append(separator);
+        result->append(items[i]);
+    }
+}
 
-    bool first = true;
+void history_t::get_unique_items(wcstring_list_t *result, size_t max_count) {
+    scoped_lock locker(lock);
 
     std::set<wcstring> seen;
 
@@ -854,6 +1118,8 @@ void history_t::get_string_representation(wcstring *result, const wcstring &sepa
     // http://github.com/fish-shell/fish-shell/issues/431.
     for (history_item_list_t::reverse_iterator iter = new_items.rbegin(); iter < new_items.rend();
          ++iter) {
+        if (result->size() >= max_count) return;
+
         // Skip a pending item if we have one.
         if (next_is_pending) {
             next_is_pending = false;
@@ -861,27 +1127,27 @@ void history_t::get_string_representation(wcstring *result, const wcstring &sepa
         }
 
         // Skip duplicates.
-        if (!seen.insert(iter->str()).second) continue;
+        wcstring str = iter->str();
+        if (!seen.insert(str).second) continue;
 
-        if (!first) result->append(separator);
-        result->append(iter->str());
-        first = false;
+        result->push_back(std::move(str));
     }
 
     // Append old items.
     load_old_if_needed();
     for (std::deque<size_t>::reverse_iterator iter = old_item_offsets.rbegin();
          iter != old_item_offsets.rend(); ++iter) {
+        if (result->size() >= max_count) return;
+
         size_t offset = *iter;
         const history_item_t item =
             decode_item(mmap_start + offset, mmap_length - offset, mmap_type);
 
         // Skip duplicates.
-        if (!seen.insert(item.str()).second) continue;
+        wcstring str = item.str();
+        if (!seen.insert(str).second) continue;
 
-        if (!first) result->append(separator);
-        result->append(item.str());
-        first = false;
+        result->push_back(std::move(str));
     }
 }
 
@@ -911,15 +1177,755 @@ history_item_t history_t::item_at_index(size_t idx) {
     if (idx < old_item_count) {
         // idx == 0 corresponds to last item in old_item_offsets.
         size_t offset = old_item_offsets.at(old_item_count - idx - 1);
-        return decode_item(mmap_start + offset, mmap_length - offset, mmap_type);
+        return decode_old_item(offset);
     }
 
     // Index past the valid range, so return an empty history item.
     return history_item_t(wcstring(), 0);
 }
 
+history_item_t history_t::decode_old_item(size_t offset) {
+    ASSERT_IS_LOCKED(lock);
+    const history_item_t *cached = item_cache->get(offset);
+    if (cached != NULL) {
+        item_cache_hits++;
+        return *cached;
+    }
+    item_cache_misses++;
+    history_item_t item = decode_item(mmap_start + offset, mmap_length - offset, mmap_type);
+    item_cache->insert(offset, item);
+    return item;
+}
+
+void history_t::old_items_in_time_range(time_t since, time_t until, size_t *out_begin,
+                                        size_t *out_end) {
+    ASSERT_IS_LOCKED(lock);
+    const size_t count = old_item_offsets.size();
+    if (!time_index || time_index->generation != old_items_generation ||
+        time_index->latest_up_to.size() != count) {
+        // Get the timestamps without decoding the items, if the format lets us.
+        std::vector<time_t> timestamps(count);
+        for (size_t i = 0; i < count; i++) {
+            size_t offset = old_item_offsets[i];
+            timestamps[i] = mmap_type == history_type_fish_2_0
+                                ? timestamp_of_item_fish_2_0(mmap_start + offset,
+                                                             mmap_length - offset)
+                                : decode_item(mmap_start + offset, mmap_length - offset,
+                                              mmap_type).timestamp();
+        }
+        time_index.reset(new history_time_index_t());
+        time_index->generation = old_items_generation;
+        time_index->latest_up_to.resize(count);
+        time_index->earliest_from.resize(count);
+        time_t latest = std::numeric_limits<time_t>::min();
+        for (size_t i = 0; i < count; i++) {
+            latest = std::max(latest, timestamps[i]);
+            time_index->latest_up_to[i] = latest;
+        }
+        time_t earliest = std::numeric_limits<time_t>::max();
+        for (size_t i = count; i-- > 0;) {
+            earliest = std::min(earliest, timestamps[i]);
+            time_index->earliest_from[i] = earliest;
+        }
+    }
+
+    // Everything before the first item with a latest timestamp of since or later is too old, and
+    // everything from the first item with an earliest timestamp after until on is too new.
+    const std::vector<time_t> &latest_up_to = time_index->latest_up_to;
+    const std::vector<time_t> &earliest_from = time_index->earliest_from;
+    *out_begin = std::lower_bound(latest_up_to.begin(), latest_up_to.end(), since) -
+                 latest_up_to.begin();
+    *out_end = std::upper_bound(earliest_from.begin(), earliest_from.end(), until) -
+               earliest_from.begin();
+    if (*out_end < *out_begin) *out_end = *out_begin;
+}
+
+void history_t::get_item_cache_stats(size_t *out_hits, size_t *out_misses) {
+    scoped_lock locker(lock);
+    *out_hits = item_cache_hits;
+    *out_misses = item_cache_misses;
+}
+
+/// The history index is a file next to the history file that records the offset and timestamp of
+/// each item, so that loading the history does not have to scan the whole file. It starts with this
+/// header, followed by count entries. The index only grows: when items are appended to the history
+/// file, their entries are appended and the header rewritten. A rewritten history file has a new
+/// inode, which invalidates the index.
+struct history_index_header_t {
+    char magic[8];
+    // The file the index describes.
+    uint64_t device;
+    uint64_t inode;
+    // How much of the file has been indexed, and a hash of the last bytes of that, so that a file
+    // that was truncated and grew again is not mistaken for an appended one.
+    uint64_t length;
+    uint64_t tail_hash;
+    // The number of entries that follow.
+    uint64_t count;
+};
+
+struct history_index_entry_t {
+    uint64_t offset;
+    int64_t timestamp;  // 0 if the item has no timestamp
+};
+
+static const char history_index_magic[8] = {'f', 'i', 's', 'h', 'i', 'd', 'x', '1'};
+
+/// Returns the FNV-1a hash of the up to 64 bytes of the history file before the given length.
+static uint64_t history_index_tail_hash(const char *begin, size_t length) {
+    size_t start = length > 64 ? length - 64 : 0;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = start; i < length; i++) {
+        hash = (hash ^ (unsigned char)begin[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/// Reads the entries of the index in fd, if it describes a prefix of the given mapped history file.
+/// Returns false if there is no valid index.
+static bool read_history_index(int fd, const file_id_t &file_id, const char *begin, size_t length,
+                               history_index_header_t *header,
+                               std::vector<history_index_entry_t> *entries) {
+    if (pread(fd, header, sizeof *header, 0) != (ssize_t)sizeof *header) return false;
+    if (memcmp(header->magic, history_index_magic, sizeof header->magic) != 0 ||
+        header->device != (uint64_t)file_id.device || header->inode != (uint64_t)file_id.inode ||
+        header->length > length ||
+        header->tail_hash != history_index_tail_hash(begin, header->length)) {
+        return false;
+    }
+
+    struct stat buf;
+    if (fstat(fd, &buf) != 0 ||
+        header->count > ((uint64_t)buf.st_size - sizeof *header) / sizeof(history_index_entry_t)) {
+        return false;
+    }
+    entries->resize(header->count);
+    size_t entries_size = entries->size() * sizeof(history_index_entry_t);
+    if (entries_size > 0 &&
+        pread(fd, &entries->at(0), entries_size, sizeof *header) != (ssize_t)entries_size) {
+        return false;
+    }
+    for (size_t i = 0; i < entries->size(); i++) {
+        if (entries->at(i).offset >= header->length) return false;
+    }
+    return true;
+}
+
+/// Writes the entries starting at first_new_entry and then the header to the index in fd. If
+/// first_new_entry is zero the index is rewritten from scratch.
+static bool write_history_index(int fd, const history_index_header_t &header,
+                                const std::vector<history_index_entry_t> &entries,
+                                size_t first_new_entry) {
+    if (first_new_entry == 0 && ftruncate(fd, 0) != 0) return false;
+    if (first_new_entry < entries.size()) {
+        size_t size = (entries.size() - first_new_entry) * sizeof(history_index_entry_t);
+        off_t offset = sizeof header + first_new_entry * sizeof(history_index_entry_t);
+        if (pwrite(fd, &entries.at(first_new_entry), size, offset) != (ssize_t)size) return false;
+    }
+    // Write the header last, so that an interrupted update leaves the old index valid.
+    return pwrite(fd, &header, sizeof header, 0) == (ssize_t)sizeof header;
+}
+
+bool history_t::populate_from_index(void) {
+    // Loading only reads the index. It is created and kept up to date when saving, which holds
+    // the history file's write lock anyway.
+    wcstring index_path = history_filename(name, L".idx");
+    if (index_path.empty()) return false;
+    int fd = wopen_cloexec(index_path, O_RDONLY);
+    if (fd < 0) return false;
+    if (!chaos_mode) history_file_lock(fd, LOCK_SH);
+    history_index_header_t header;
+    std::vector<history_index_entry_t> entries;
+    const bool valid =
+        read_history_index(fd, mmap_file_id, mmap_start, mmap_length, &header, &entries);
+    if (!chaos_mode) history_file_lock(fd, LOCK_UN);
+    close(fd);
+    if (!valid) return false;
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        add_scanned_item((size_t)entries[i].offset, (time_t)entries[i].timestamp);
+    }
+
+    // Scan the items appended since the index was last updated.
+    size_t cursor = header.length;
+    for (;;) {
+        time_t timestamp = 0;
+        size_t offset =
+            offset_of_next_item_fish_2_0(mmap_start, mmap_length, &cursor, 0, &timestamp);
+        if (offset == (size_t)-1) break;
+        add_scanned_item(offset, timestamp);
+    }
+    old_items_scanned_length = cursor;
+    return true;
+}
+
+void history_t::update_index(int fd) const {
+    wcstring index_path = history_filename(name, L".idx");
+    struct stat buf;
+    if (index_path.empty() || fstat(fd, &buf) != 0 || buf.st_size == 0) return;
+
+    // The caller holds the write lock of the history file, so map it without map_fd's read lock.
+    const size_t length = (size_t)buf.st_size;
+    void *map = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) return;
+    const char *const begin = (const char *)map;
+    if (infer_file_type(begin, length) != history_type_fish_2_0) {
+        munmap(map, length);
+        return;
+    }
+
+    int index_fd = wopen_cloexec(index_path, O_RDWR | O_CREAT, history_file_mode);
+    if (index_fd >= 0) {
+        if (!chaos_mode) history_file_lock(index_fd, LOCK_EX);
+        const file_id_t file_id = file_id_for_fd(fd);
+        history_index_header_t header;
+        std::vector<history_index_entry_t> entries;
+        const bool valid = read_history_index(index_fd, file_id, begin, length, &header, &entries);
+        if (!valid) {
+            entries.clear();
+            memcpy(header.magic, history_index_magic, sizeof header.magic);
+            header.device = (uint64_t)file_id.device;
+            header.inode = (uint64_t)file_id.inode;
+            header.length = 0;
+        }
+
+        // Index the items appended since the index was last updated. The cutoff is applied when
+        // loading, since the index is shared with other instances.
+        const size_t first_new_entry = entries.size();
+        size_t cursor = header.length;
+        for (;;) {
+            history_index_entry_t entry;
+            time_t timestamp = 0;
+            size_t offset = offset_of_next_item_fish_2_0(begin, length, &cursor, 0, &timestamp);
+            if (offset == (size_t)-1) break;
+            entry.offset = offset;
+            entry.timestamp = timestamp;
+            entries.push_back(entry);
+        }
+
+        if (!valid || cursor != header.length) {
+            header.length = cursor;
+            header.tail_hash = history_index_tail_hash(begin, cursor);
+            header.count = entries.size();
+            if (!write_history_index(index_fd, header, entries, valid ? first_new_entry : 0)) {
+                debug(2, L"Unable to write history index '%ls'", index_path.c_str());
+            }
+        }
+        if (!chaos_mode) history_file_lock(index_fd, LOCK_UN);
+        close(index_fd);
+    }
+    munmap(map, length);
+}
+
+/// Packs the three characters of str starting at i into a trigram. Characters are truncated to 21
+/// bits, which covers all of Unicode; a collision only costs a spurious candidate.
+static uint64_t trigram_at(const wcstring &str, size_t i) {
+    const uint64_t mask = 0x1FFFFF;
+    return ((uint64_t)(str[i] & mask) << 42) | ((uint64_t)(str[i + 1] & mask) << 21) |
+           (uint64_t)(str[i + 2] & mask);
+}
+
+/// Sets out to the distinct trigrams of str, sorted.
+static void get_trigrams(const wcstring &str, std::vector<uint64_t> *out) {
+    out->clear();
+    for (size_t i = 0; i + 3 <= str.size(); i++) {
+        out->push_back(trigram_at(str, i));
+    }
+    std::sort(out->begin(), out->end());
+    out->erase(std::unique(out->begin(), out->end()), out->end());
+}
+
+/// Maps the offsets of the items of a rewritten history file to the offsets of the items with the
+/// same contents in the new file. Items that were dropped are missing.
+typedef std::unordered_map<uint32_t, uint32_t> history_offset_remap_t;
+
+/// Where the items of a history file went when it was rewritten, see rewrite_to_temporary_file.
+struct history_offset_map_t {
+    /// The file that was rewritten.
+    file_id_t source_file_id = kInvalidFileID;
+    history_offset_remap_t offsets;
+};
+
+/// A trigram index of lowercased history items. It maps each trigram to the offsets of the items
+/// containing it, in increasing order. An item contains a term only if it contains all of the
+/// term's trigrams, so intersecting their posting lists gives a small set of candidates to check.
+class history_trigram_index_t {
+    std::unordered_map<uint64_t, std::vector<uint32_t>> postings;
+
+   public:
+    /// Adds the item at the given offset, which must be larger than that of any item added before.
+    void add_item(uint32_t offset, const wcstring &contents_lower) {
+        std::vector<uint64_t> trigrams;
+        get_trigrams(contents_lower, &trigrams);
+        for (size_t i = 0; i < trigrams.size(); i++) {
+            postings[trigrams[i]].push_back(offset);
+        }
+    }
+
+    /// Adds the items of another index whose offsets the remap knows, at their new offsets. Call
+    /// finish_remapping once done.
+    void add_remapped(const history_trigram_index_t &other, const history_offset_remap_t &remap) {
+        for (const auto &posting : other.postings) {
+            std::vector<uint32_t> *list = NULL;
+            for (uint32_t offset : posting.second) {
+                auto iter = remap.find(offset);
+                if (iter == remap.end()) continue;
+                if (list == NULL) list = &postings[posting.first];
+                list->push_back(iter->second);
+            }
+        }
+    }
+
+    /// Restores the order of the posting lists after add_remapped.
+    void finish_remapping() {
+        for (auto &posting : postings) {
+            std::vector<uint32_t> &list = posting.second;
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+        }
+    }
+
+    /// Appends the offsets of the items that may contain lterm to out, in increasing order.
+    /// Returns false if the term is too short to have a trigram.
+    bool get_candidates(const wcstring &lterm, std::vector<uint32_t> *out) const {
+        std::vector<uint64_t> trigrams;
+        get_trigrams(lterm, &trigrams);
+        if (trigrams.empty()) return false;
+
+        // Intersect the posting lists, shortest first.
+        std::vector<const std::vector<uint32_t> *> lists;
+        for (size_t i = 0; i < trigrams.size(); i++) {
+            auto iter = postings.find(trigrams[i]);
+            if (iter == postings.end()) return true;
+            lists.push_back(&iter->second);
+        }
+        std::sort(lists.begin(), lists.end(),
+                  [](const std::vector<uint32_t> *a, const std::vector<uint32_t> *b) {
+                      return a->size() < b->size();
+                  });
+
+        std::vector<uint32_t> result = *lists.front();
+        std::vector<uint32_t> intersection;
+        for (size_t i = 1; i < lists.size() && !result.empty(); i++) {
+            intersection.clear();
+            std::set_intersection(result.begin(), result.end(), lists[i]->begin(), lists[i]->end(),
+                                  std::back_inserter(intersection));
+            result.swap(intersection);
+        }
+        out->insert(out->end(), result.begin(), result.end());
+        return true;
+    }
+};
+
+/// Returns the command of the fish 2.0 item at the given offset as it appears in the file, that is
+/// still escaped. Returns the whole first line if it is malformed.
+static std::pair<const char *, size_t> raw_command_fish_2_0(const char *base, size_t len,
+                                                            size_t offset) {
+    const char *start = base + offset;
+    const char *end = (const char *)memchr(start, '\n', len - offset);
+    if (end == NULL) end = base + len;
+    const char *cmd_prefix = "- cmd: ";
+    const size_t cmd_prefix_len = strlen(cmd_prefix);
+    if ((size_t)(end - start) >= cmd_prefix_len && !memcmp(start, cmd_prefix, cmd_prefix_len)) {
+        start += cmd_prefix_len;
+    }
+    return std::make_pair(start, (size_t)(end - start));
+}
+
+/// Compares the first at most max_len bytes of a and b, as memcmp would.
+static int compare_raw(const std::pair<const char *, size_t> &a,
+                       const std::pair<const char *, size_t> &b, size_t max_len = (size_t)-1) {
+    size_t alen = std::min(a.second, max_len), blen = std::min(b.second, max_len);
+    int cmp = memcmp(a.first, b.first, std::min(alen, blen));
+    if (cmp == 0 && alen != blen) cmp = alen < blen ? -1 : 1;
+    return cmp;
+}
+
+/// A prefix index of history items. It stores the offsets of the items sorted by their escaped
+/// commands. Escaping is done one character at a time and no escape sequence is a prefix of
+/// another, so the items starting with a given prefix form a range of that order. A max segment
+/// tree over the offsets then gives the most recent items in the range without visiting the rest
+/// of it.
+class history_prefix_index_t {
+    std::vector<uint32_t> sorted;
+    // tree[sorted.size() + i] is i, and tree[i] is whichever child refers to the larger offset.
+    std::vector<uint32_t> tree;
+
+    uint32_t max_of(uint32_t a, uint32_t b) const { return sorted[a] < sorted[b] ? b : a; }
+
+    /// Returns the index in sorted of the largest offset in [begin, end), which is not empty.
+    uint32_t max_in_range(size_t begin, size_t end) const {
+        const size_t n = sorted.size();
+        uint32_t result = (uint32_t)begin;
+        for (size_t lo = begin + n, hi = end + n; lo < hi; lo /= 2, hi /= 2) {
+            if (lo & 1) result = max_of(result, tree[lo++]);
+            if (hi & 1) result = max_of(result, tree[--hi]);
+        }
+        return result;
+    }
+
+   public:
+    /// Builds the index from the offsets of the items and their commands.
+    history_prefix_index_t(const std::vector<uint32_t> &offsets,
+                           const std::vector<std::pair<const char *, size_t>> &commands) {
+        const size_t n = offsets.size();
+        std::vector<uint32_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return compare_raw(commands[a], commands[b]) < 0;
+        });
+        sorted.resize(n);
+        for (size_t i = 0; i < n; i++) sorted[i] = offsets[order[i]];
+        tree.resize(2 * n);
+        for (size_t i = 0; i < n; i++) tree[n + i] = (uint32_t)i;
+        for (size_t i = n; i-- > 1;) tree[i] = max_of(tree[2 * i], tree[2 * i + 1]);
+    }
+
+    size_t memory_size() const { return (sorted.size() + tree.size()) * sizeof(uint32_t); }
+
+    /// Appends the offsets of the at most max_count most recent items whose commands start with
+    /// prefix to out, in decreasing order. get_command returns the command of the item at an
+    /// offset. Returns whether that was all of them.
+    template <typename Getter>
+    bool get_candidates(const std::string &prefix, size_t max_count, const Getter &get_command,
+                        std::vector<uint32_t> *out) const {
+        const std::pair<const char *, size_t> key(prefix.data(), prefix.size());
+        auto begin = std::lower_bound(sorted.begin(), sorted.end(), key,
+                                      [&](uint32_t pos, const std::pair<const char *, size_t> &k) {
+                                          return compare_raw(get_command(pos), k, k.second) < 0;
+                                      });
+        auto end = std::upper_bound(begin, sorted.end(), key,
+                                    [&](const std::pair<const char *, size_t> &k, uint32_t pos) {
+                                        return compare_raw(k, get_command(pos), k.second) < 0;
+                                    });
+
+        // Take the most recent item of a range, and split the rest of it in two.
+        struct range_t {
+            uint32_t offset, max_idx, begin, end;
+            bool operator<(const range_t &rhs) const { return offset < rhs.offset; }
+        };
+        std::vector<range_t> heap;
+        auto push_range = [&](size_t b, size_t e) {
+            if (b >= e) return;
+            uint32_t max_idx = max_in_range(b, e);
+            heap.push_back({sorted[max_idx], max_idx, (uint32_t)b, (uint32_t)e});
+            std::push_heap(heap.begin(), heap.end());
+        };
+        push_range(begin - sorted.begin(), end - sorted.begin());
+        for (size_t found = 0; !heap.empty() && found < max_count; found++) {
+            std::pop_heap(heap.begin(), heap.end());
+            range_t range = heap.back();
+            heap.pop_back();
+            out->push_back(range.offset);
+            push_range(range.begin, range.max_idx);
+            push_range(range.max_idx + 1, range.end);
+        }
+        return heap.empty();
+    }
+};
+
+/// The indexes of some of the items of a fish 2.0 history file.
+class history_search_segment_t {
+   public:
+    history_trigram_index_t trigrams;
+    std::unique_ptr<history_prefix_index_t> prefixes;
+};
+
+/// The indexes used to speed up searches of the old items. They cover the items of the file that
+/// start before indexed_length, in one segment for the first build and one for every extension
+/// by appended items. Vacuuming the file remaps them into a single segment.
+class history_search_index_t {
+   public:
+    file_id_t file_id = kInvalidFileID;
+    size_t indexed_length = 0;
+    // The bytes just before indexed_length, to tell that the file still starts the same.
+    std::string tail;
+    std::vector<std::shared_ptr<const history_search_segment_t>> segments;
+
+    /// Returns the index that the remap makes of this one, for a file mapped at the given address
+    /// which has the given id, and whose first indexed_length bytes the remapped items cover.
+    std::shared_ptr<history_search_index_t> remap(const history_offset_remap_t &remap,
+                                                  const char *start, size_t length,
+                                                  file_id_t new_file_id,
+                                                  size_t new_indexed_length) const {
+        std::shared_ptr<history_search_segment_t> segment =
+            std::make_shared<history_search_segment_t>();
+        for (const auto &old_segment : segments) {
+            segment->trigrams.add_remapped(old_segment->trigrams, remap);
+        }
+        segment->trigrams.finish_remapping();
+
+        std::vector<uint32_t> offsets;
+        std::vector<std::pair<const char *, size_t>> commands;
+        for (const auto &entry : remap) offsets.push_back(entry.second);
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+        for (uint32_t offset : offsets) {
+            commands.push_back(raw_command_fish_2_0(start, length, offset));
+        }
+        segment->prefixes.reset(new history_prefix_index_t(offsets, commands));
+
+        std::shared_ptr<history_search_index_t> result = std::make_shared<history_search_index_t>();
+        result->file_id = new_file_id;
+        result->indexed_length = new_indexed_length;
+        size_t tail_length = std::min(new_indexed_length, (size_t)64);
+        result->tail.assign(start + new_indexed_length - tail_length, tail_length);
+        result->segments.push_back(segment);
+        return result;
+    }
+};
+
+bool history_t::search_index_is_current() const {
+    ASSERT_IS_LOCKED(lock);
+    if (!search_index || !loaded_old || mmap_start == NULL || mmap_type != history_type_fish_2_0) {
+        return false;
+    }
+    const history_search_index_t &index = *search_index;
+    return index.file_id.device == mmap_file_id.device &&
+           index.file_id.inode == mmap_file_id.inode && index.indexed_length <= mmap_length &&
+           !memcmp(mmap_start + index.indexed_length - index.tail.size(), index.tail.data(),
+                   index.tail.size());
+}
+
+size_t history_t::first_unindexed_old_item() const {
+    ASSERT_IS_LOCKED(lock);
+    return std::lower_bound(old_item_offsets.begin(), old_item_offsets.end(),
+                            search_index->indexed_length) -
+           old_item_offsets.begin();
+}
+
+void history_t::build_search_index_in_background(void) {
+    {
+        scoped_lock locker(lock);
+        if (search_index_building) return;
+        if (loaded_old) {
+            // Items appended since the index was built are checked by every search, until there
+            // are enough of them to be worth adding to the index.
+            if (old_item_offsets.size() < HISTORY_SEARCH_INDEX_MIN_ITEMS) return;
+            if (search_index_is_current() &&
+                old_item_offsets.size() - first_unindexed_old_item() <
+                    HISTORY_SEARCH_INDEX_EXTEND_ITEMS) {
+                return;
+            }
+        }
+        search_index_building = true;
+    }
+    iothread_perform([this]() { this->build_search_index(HISTORY_SEARCH_INDEX_MIN_ITEMS); });
+}
+
+void history_t::build_search_index(size_t min_items) {
+    double start_time = timef();
+    std::shared_ptr<const history_search_index_t> base;
+    std::vector<uint32_t> offsets;
+    file_id_t file_id;
+    size_t end_length;
+    {
+        scoped_lock locker(lock);
+        load_old_if_needed();
+        if (old_item_offsets.size() < min_items || mmap_start == NULL ||
+            mmap_type != history_type_fish_2_0 ||
+            old_items_scanned_length > std::numeric_limits<uint32_t>::max()) {
+            search_index_building = false;
+            return;
+        }
+
+        // Index the items after what the current index covers, including those deferred for now.
+        if (search_index_is_current()) base = search_index;
+        const size_t start_length = base ? base->indexed_length : 0;
+        for (auto iter = std::lower_bound(old_item_offsets.begin(), old_item_offsets.end(),
+                                          start_length);
+             iter != old_item_offsets.end(); ++iter) {
+            offsets.push_back((uint32_t)*iter);
+        }
+        for (size_t i = 0; i < deferred_old_items.size(); i++) {
+            size_t offset = deferred_old_items[i].first;
+            if (offset >= start_length) offsets.push_back((uint32_t)offset);
+        }
+        std::sort(offsets.begin(), offsets.end());
+        file_id = mmap_file_id;
+        end_length = old_items_scanned_length;
+    }
+
+    // Decode the items in chunks, so that we don't hold the lock for long. Give up if the file is
+    // replaced underneath us; the next search will start over. The escaped commands are copied
+    // out so that they can be sorted without the lock.
+    std::shared_ptr<history_search_segment_t> segment =
+        std::make_shared<history_search_segment_t>();
+    const size_t chunk_size = 1024;
+    wcstring_list_t chunk;
+    std::string commands_blob;
+    std::vector<std::pair<size_t, size_t>> command_ranges;
+    bool ok = true;
+    for (size_t start = 0; start < offsets.size() && ok; start += chunk_size) {
+        chunk.clear();
+        {
+            scoped_lock locker(lock);
+            ok = !search_index_abandoned && loaded_old && mmap_start != NULL &&
+                 mmap_file_id.device == file_id.device && mmap_file_id.inode == file_id.inode &&
+                 mmap_length >= end_length;
+            for (size_t i = start; ok && i < offsets.size() && i < start + chunk_size; i++) {
+                size_t offset = offsets.at(i);
+                chunk.push_back(decode_item(mmap_start + offset, mmap_length - offset,
+                                            history_type_fish_2_0)
+                                    .str_lower());
+                std::pair<const char *, size_t> cmd =
+                    raw_command_fish_2_0(mmap_start, mmap_length, offset);
+                command_ranges.push_back(std::make_pair(commands_blob.size(), cmd.second));
+                commands_blob.append(cmd.first, cmd.second);
+            }
+        }
+        for (size_t i = 0; i < chunk.size(); i++) {
+            segment->trigrams.add_item(offsets.at(start + i), chunk[i]);
+        }
+    }
+
+    if (ok) {
+        std::vector<std::pair<const char *, size_t>> commands;
+        commands.reserve(command_ranges.size());
+        for (size_t i = 0; i < command_ranges.size(); i++) {
+            commands.push_back(std::make_pair(commands_blob.data() + command_ranges[i].first,
+                                              command_ranges[i].second));
+        }
+        segment->prefixes.reset(new history_prefix_index_t(offsets, commands));
+    }
+
+    scoped_lock locker(lock);
+    ok = ok && !search_index_abandoned && loaded_old && mmap_start != NULL &&
+         mmap_file_id.device == file_id.device && mmap_file_id.inode == file_id.inode &&
+         mmap_length >= end_length;
+    // Extend the index only if nothing replaced it meanwhile.
+    if (ok && (base ? search_index == base && search_index_is_current() : true)) {
+        std::shared_ptr<history_search_index_t> index = std::make_shared<history_search_index_t>();
+        if (base) index->segments = base->segments;
+        index->segments.push_back(segment);
+        index->file_id = file_id;
+        index->indexed_length = end_length;
+        size_t tail_length = std::min(end_length, (size_t)64);
+        index->tail.assign(mmap_start + end_length - tail_length, tail_length);
+        search_index = index;
+        debug(2, L"%ls history search index by %lu items in %.0f ms (prefix index %lu KB)",
+              base ? L"Extended" : L"Built", (unsigned long)offsets.size(),
+              (timef() - start_time) * 1000,
+              (unsigned long)segment->prefixes->memory_size() / 1024);
+    }
+    search_index_building = false;
+}
+
+void history_t::get_candidate_indexes(const std::vector<size_t> &positions,
+                                      std::vector<size_t> *out_indexes) const {
+    // New items are few and already decoded, so they are all candidates. Indexes of old items
+    // count back from the most recent one, see item_at_index.
+    size_t resolved_new_item_count = new_items.size();
+    if (this->has_pending_item && resolved_new_item_count > 0) {
+        resolved_new_item_count -= 1;
+    }
+    const size_t old_item_count = old_item_offsets.size();
+    out_indexes->clear();
+    out_indexes->reserve(resolved_new_item_count + positions.size());
+    for (size_t idx = 1; idx <= resolved_new_item_count; idx++) {
+        out_indexes->push_back(idx);
+    }
+    for (size_t i = 0; i < positions.size(); i++) {
+        out_indexes->push_back(resolved_new_item_count + old_item_count - positions[i]);
+    }
+}
+
+/// Sets out_positions to the positions in old_item_offsets of the given candidate offsets of the
+/// indexed items, in decreasing order, after those of all the items the index does not cover.
+/// Offsets of items that are not old items, like deferred ones, are skipped.
+static void candidate_positions(const std::deque<size_t> &old_item_offsets,
+                                size_t first_unindexed, const std::vector<uint32_t> &offsets,
+                                std::vector<size_t> *out_positions) {
+    out_positions->clear();
+    for (size_t pos = old_item_offsets.size(); pos-- > first_unindexed;) {
+        out_positions->push_back(pos);
+    }
+    const auto indexed_end = old_item_offsets.begin() + first_unindexed;
+    for (size_t i = offsets.size(); i-- > 0;) {
+        auto iter = std::lower_bound(old_item_offsets.begin(), indexed_end, (size_t)offsets[i]);
+        if (iter != indexed_end && *iter == offsets[i]) {
+            out_positions->push_back(iter - old_item_offsets.begin());
+        }
+    }
+}
+
+bool history_t::get_contains_candidates(const wcstring &lterm, std::vector<size_t> *out_indexes) {
+    scoped_lock locker(lock);
+    if (!search_index_is_current()) return false;
+    // The segments cover increasing ranges of offsets, except for duplicates that candidate
+    // positions skips.
+    std::vector<uint32_t> offsets;
+    for (const auto &segment : search_index->segments) {
+        if (!segment->trigrams.get_candidates(lterm, &offsets)) return false;
+    }
+    std::sort(offsets.begin(), offsets.end());
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+
+    std::vector<size_t> positions;
+    candidate_positions(old_item_offsets, first_unindexed_old_item(), offsets, &positions);
+    get_candidate_indexes(positions, out_indexes);
+    return true;
+}
+
+bool history_t::get_prefix_candidates(const wcstring &prefix, size_t max_count,
+                                      std::vector<size_t> *out_indexes, bool *out_complete) {
+    scoped_lock locker(lock);
+    if (!search_index_is_current()) return false;
+
+    // The index is sorted by the escaped commands in the file, so escape the prefix the same way.
+    std::string encoded_prefix = wcs2string(prefix);
+    escape_yaml(&encoded_prefix);
+    auto get_command = [this](uint32_t offset) {
+        return raw_command_fish_2_0(mmap_start, mmap_length, offset);
+    };
+    // Each segment gives its most recent matches; the most recent of all of them are among those.
+    std::vector<uint32_t> offsets;
+    bool complete = true;
+    for (const auto &segment : search_index->segments) {
+        complete = segment->prefixes->get_candidates(encoded_prefix, max_count, get_command,
+                                                     &offsets) &&
+                   complete;
+    }
+    std::sort(offsets.begin(), offsets.end());
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+    if (offsets.size() > max_count) {
+        offsets.erase(offsets.begin(), offsets.end() - max_count);
+        complete = false;
+    }
+    *out_complete = complete;
+
+    std::vector<size_t> positions;
+    candidate_positions(old_item_offsets, first_unindexed_old_item(), offsets, &positions);
+    get_candidate_indexes(positions, out_indexes);
+    return true;
+}
+
+void history_t::add_scanned_item(size_t offset, time_t timestamp) {
+    if (timestamp == 0 || timestamp <= boundary_timestamp) {
+        old_item_offsets.push_back(offset);
+    } else {
+        deferred_old_items.push_back(std::make_pair(offset, timestamp));
+    }
+}
+
 void history_t::populate_from_mmap(void) {
     mmap_type = infer_file_type(mmap_start, mmap_length);
+    if (mmap_type == history_type_fish_2_0) {
+        if (populate_from_index()) return;
+
+        // Remember the items past the cutoff, so that they can be added without a rescan.
+        size_t cursor = 0;
+        for (;;) {
+            time_t timestamp = 0;
+            size_t offset =
+                offset_of_next_item_fish_2_0(mmap_start, mmap_length, &cursor, 0, &timestamp);
+            if (offset == (size_t)-1) break;
+            add_scanned_item(offset, timestamp);
+        }
+        old_items_scanned_length = cursor;
+        return;
+    }
+
     size_t cursor = 0;
     for (;;) {
         size_t offset =
@@ -1024,6 +2030,21 @@ bool history_search_t::go_forwards() {
     return false;
 }
 
+void history_search_t::update_candidates() {
+    has_candidates = false;
+    if (search_type == HISTORY_SEARCH_TYPE_CONTAINS) {
+        wcstring lterm;
+        for (wcstring::const_iterator it = term.begin(); it != term.end(); ++it) {
+            lterm.push_back(towlower(*it));
+        }
+        has_candidates = history->get_contains_candidates(lterm, &candidates);
+        candidates_complete = true;
+    } else if (search_type == HISTORY_SEARCH_TYPE_PREFIX && case_sensitive) {
+        has_candidates = history->get_prefix_candidates(term, candidate_limit, &candidates,
+                                                        &candidates_complete);
+    }
+}
+
 bool history_search_t::go_backwards() {
     // Backwards means increasing our index.
     const size_t max_idx = (size_t)-1;
@@ -1035,6 +2056,39 @@ bool history_search_t::go_backwards() {
 
     const bool main_thread = is_main_thread();
 
+    if (!checked_candidates) {
+        checked_candidates = true;
+        update_candidates();
+    }
+
+    while (has_candidates) {
+        // Only look at the items the search index says may match.
+        for (std::vector<size_t>::const_iterator iter =
+                 std::upper_bound(candidates.begin(), candidates.end(), idx);
+             iter != candidates.end(); ++iter) {
+            if (main_thread ? reader_interrupted() : reader_thread_job_is_stale()) {
+                return false;
+            }
+
+            const history_item_t item = history->item_at_index(*iter);
+            if (item.empty()) return false;
+
+            const wcstring &str = item.str();
+            if (item.matches_search(term, search_type, case_sensitive) &&
+                !match_already_made(str) && !should_skip_match(str)) {
+                prev_matches.push_back(prev_match_t(*iter, item));
+                return true;
+            }
+            idx = *iter;
+        }
+        if (candidates_complete) return false;
+
+        // Every item up to idx has been looked at; fetch a larger batch to continue past it. If the
+        // index went away in the meantime, fall back to looking at everything after idx.
+        candidate_limit *= 4;
+        update_candidates();
+    }
+
     while (++idx < max_idx) {
         if (main_thread ? reader_interrupted() : reader_thread_job_is_stale()) {
             return false;
@@ -1156,13 +2210,82 @@ void history_t::clear_file_state() {
     mmap_start = NULL;
     mmap_length = 0;
     loaded_old = false;
+    item_cache->evict_all_nodes();
     old_item_offsets.clear();
+    old_items_scanned_length = 0;
+    deferred_old_items.clear();
+    old_items_generation++;
+}
+
+bool history_t::incorporate_appended_items(void) {
+    ASSERT_IS_LOCKED(lock);
+    if (!loaded_old || mmap_start == NULL || mmap_type != history_type_fish_2_0) return false;
+
+    // A rewritten file is a new file, see save_internal_via_rewrite.
+    wcstring filename = history_filename(name, L"");
+    int fd = filename.empty() ? -1 : wopen_cloexec(filename, O_RDONLY);
+    if (fd < 0) return false;
+    const file_id_t file_id = file_id_for_fd(fd);
+    const char *new_start = NULL;
+    size_t new_length = 0;
+    bool ok = file_id.device == mmap_file_id.device && file_id.inode == mmap_file_id.inode &&
+              map_fd(fd, &new_start, &new_length);
+    close(fd);
+    if (!ok) return false;
+
+    // Check that the end of the part we know is unchanged, in case the file was truncated or
+    // modified in place.
+    const size_t check_length = std::min(mmap_length, (size_t)64);
+    if (new_length < mmap_length ||
+        memcmp(new_start + mmap_length - check_length, mmap_start + mmap_length - check_length,
+               check_length) != 0) {
+        munmap((void *)new_start, new_length);
+        return false;
+    }
+    munmap((void *)mmap_start, mmap_length);
+    mmap_start = new_start;
+    mmap_length = new_length;
+    mmap_file_id = file_id;
+
+    // Deferred items that are now old go between the old items, by offset.
+    std::vector<std::pair<size_t, time_t>> still_deferred;
+    std::deque<size_t> offsets;
+    std::deque<size_t>::const_iterator old_iter = old_item_offsets.begin();
+    for (size_t i = 0; i < deferred_old_items.size(); i++) {
+        const std::pair<size_t, time_t> &item = deferred_old_items[i];
+        if (item.second > boundary_timestamp) {
+            still_deferred.push_back(item);
+            continue;
+        }
+        while (old_iter != old_item_offsets.end() && *old_iter < item.first) {
+            offsets.push_back(*old_iter++);
+        }
+        offsets.push_back(item.first);
+    }
+    if (still_deferred.size() != deferred_old_items.size()) {
+        offsets.insert(offsets.end(), old_iter, old_item_offsets.cend());
+        old_item_offsets.swap(offsets);
+    }
+    deferred_old_items.swap(still_deferred);
+
+    // Scan what was appended.
+    size_t cursor = old_items_scanned_length;
+    for (;;) {
+        time_t timestamp = 0;
+        size_t offset =
+            offset_of_next_item_fish_2_0(mmap_start, mmap_length, &cursor, 0, &timestamp);
+        if (offset == (size_t)-1) break;
+        add_scanned_item(offset, timestamp);
+    }
+    old_items_scanned_length = cursor;
+    old_items_generation++;
+    return true;
 }
 
 void history_t::compact_new_items() {
     // Keep only the most recent items with the given contents. This algorithm could be made more
     // efficient, but likely would consume more memory too.
-    std::set<wcstring> seen;
+    std::set<std::string> seen;
     size_t idx = new_items.size();
     while (idx--) {
         const history_item_t &item = new_items[idx];
@@ -1183,10 +2306,10 @@ void history_t::compact_new_items() {
 // Given the fd of an existing history file, or -1 if none, write
 // a new history file to temp_fd. Returns true on success, false
 // on error
-bool history_t::rewrite_to_temporary_file(int existing_fd, int dst_fd) const {
-    // This must be called while locked.
-    ASSERT_IS_LOCKED(lock);
-
+bool history_t::rewrite_to_temporary_file(int existing_fd, int dst_fd,
+                                          const history_item_list_t &extra_items,
+                                          const std::set<wcstring> &deleted,
+                                          history_offset_map_t *out_offsets) const {
     // We are reading FROM existing_fd and writing TO dst_fd
     // dst_fd must be valid; existing_fd does not need to be
     assert(dst_fd >= 0);
@@ -1198,6 +2321,11 @@ bool history_t::rewrite_to_temporary_file(int existing_fd, int dst_fd) const {
     // old mmap'd data).
     const char *local_mmap_start = NULL;
     size_t local_mmap_size = 0;
+    std::vector<std::pair<size_t, size_t>> aliases;
+    if (out_offsets) {
+        out_offsets->source_file_id = file_id_for_fd(existing_fd);
+        out_offsets->offsets.clear();
+    }
     if (existing_fd >= 0 && map_fd(existing_fd, &local_mmap_start, &local_mmap_size)) {
         const history_file_type_t local_mmap_type =
             infer_file_type(local_mmap_start, local_mmap_size);
@@ -1212,19 +2340,18 @@ bool history_t::rewrite_to_temporary_file(int existing_fd, int dst_fd) const {
             const history_item_t old_item =
                 decode_item(local_mmap_start + offset, local_mmap_size - offset, local_mmap_type);
 
-            if (old_item.empty() || deleted_items.count(old_item.str()) > 0) {
+            if (old_item.empty() || deleted.count(old_item.str()) > 0) {
                 // debug(0, L"Item is deleted : %s\n", old_item.str().c_str());
                 continue;
             }
             // Add this old item.
-            lru.add_item(old_item);
+            lru.add_item(old_item, offset, out_offsets ? &aliases : NULL);
         }
         munmap((void *)local_mmap_start, local_mmap_size);
     }
 
     // Insert any unwritten new items
-    for (auto iter = new_items.cbegin() + this->first_unwritten_new_item_index;
-         iter != new_items.cend(); ++iter) {
+    for (auto iter = extra_items.cbegin(); iter != extra_items.cend(); ++iter) {
         lru.add_item(*iter);
     }
 
@@ -1238,10 +2365,17 @@ bool history_t::rewrite_to_temporary_file(int existing_fd, int dst_fd) const {
     // Write them out.
     bool ok = true;
     history_output_buffer_t buffer(HISTORY_OUTPUT_BUFFER_SIZE);
+    size_t flushed_size = 0;
     for (const auto &key_item : lru) {
         const history_lru_item_t &item = key_item.second;
+        const size_t new_offset = flushed_size + buffer.output_size();
+        if (out_offsets && item.source_offset <= std::numeric_limits<uint32_t>::max() &&
+            new_offset <= std::numeric_limits<uint32_t>::max()) {
+            out_offsets->offsets[(uint32_t)item.source_offset] = (uint32_t)new_offset;
+        }
         append_yaml_to_buffer(item.text, item.timestamp, item.required_paths, &buffer);
         if (buffer.output_size() >= HISTORY_OUTPUT_BUFFER_SIZE) {
+            flushed_size += buffer.output_size();
             ok = buffer.flush_to_fd(dst_fd);
             if (!ok) {
                 debug(2, L"Error %d when writing to temporary history file", errno);
@@ -1256,6 +2390,16 @@ bool history_t::rewrite_to_temporary_file(int existing_fd, int dst_fd) const {
             debug(2, L"Error %d when writing to temporary history file", errno);
         }
     }
+
+    // Earlier items with the same contents as a written one went where it went. Later aliases are
+    // resolved first, so the end of a chain of them is known by the time it is reached.
+    if (out_offsets) {
+        history_offset_remap_t &offsets = out_offsets->offsets;
+        for (size_t i = aliases.size(); i-- > 0;) {
+            auto iter = offsets.find((uint32_t)aliases[i].second);
+            if (iter != offsets.end()) offsets[(uint32_t)aliases[i].first] = iter->second;
+        }
+    }
     return ok;
 }
 
@@ -1273,11 +2417,9 @@ static int create_temporary_file(const wcstring &name_template, wcstring *out_pa
     return out_fd;
 }
 
-bool history_t::save_internal_via_rewrite() {
-    // This must be called while locked.
-    ASSERT_IS_LOCKED(lock);
-    bool ok = false;
-
+bool history_t::rewrite_file(const history_item_list_t &extra_items,
+                             const std::set<wcstring> &deleted, bool require_existing,
+                             history_offset_map_t *out_offsets) const {
     // We want to rewrite the file, while holding the lock for as briefly as possible
     // To do this, we speculatively write a file, and then lock and see if our original file changed
     // Repeat until we succeed or give up
@@ -1298,9 +2440,13 @@ bool history_t::save_internal_via_rewrite() {
     bool done = false;
     for (int i = 0; i < max_save_tries && !done; i++) {
         // Open any target file, but do not lock it right away
-        int target_fd_before = wopen_cloexec(target_name, O_RDONLY | O_CREAT, history_file_mode);
+        int target_fd_before =
+            require_existing ? wopen_cloexec(target_name, O_RDONLY)
+                             : wopen_cloexec(target_name, O_RDONLY | O_CREAT, history_file_mode);
+        if (require_existing && target_fd_before < 0) break;
         file_id_t orig_file_id = file_id_for_fd(target_fd_before);  // possibly invalid
-        bool wrote = this->rewrite_to_temporary_file(target_fd_before, tmp_fd);
+        bool wrote = this->rewrite_to_temporary_file(target_fd_before, tmp_fd, extra_items,
+                                                     deleted, out_offsets);
         if (target_fd_before >= 0) {
             close(target_fd_before);
         }
@@ -1322,7 +2468,8 @@ bool history_t::save_internal_via_rewrite() {
             history_file_lock(target_fd_after, LOCK_EX);
             new_file_id = file_id_for_path(target_name);
         }
-        bool can_replace_file = (new_file_id == orig_file_id || new_file_id == kInvalidFileID);
+        bool can_replace_file = (new_file_id == orig_file_id ||
+                                 (new_file_id == kInvalidFileID && !require_existing));
         if (!can_replace_file) {
             // The file has changed, so we're going to re-read it
             // Truncate our tmp_fd so we can reuse it
@@ -1348,6 +2495,9 @@ bool history_t::save_internal_via_rewrite() {
                 }
             }
 
+            // Index the new file before it replaces the old one, while we hold the lock.
+            this->update_index(tmp_fd);
+
             // Slide it into place
             if (wrename(tmp_name, target_name) == -1) {
                 debug(2, L"Error %d when renaming history file", errno);
@@ -1365,7 +2515,15 @@ bool history_t::save_internal_via_rewrite() {
     // Ensure we never leave the old file around
     wunlink(tmp_name);
     close(tmp_fd);
+    return done;
+}
 
+bool history_t::save_internal_via_rewrite() {
+    // This must be called while locked.
+    ASSERT_IS_LOCKED(lock);
+    const history_item_list_t unwritten_items(new_items.begin() + first_unwritten_new_item_index,
+                                              new_items.end());
+    bool done = this->rewrite_file(unwritten_items, deleted_items, false);
     if (done) {
         // We've saved everything, so we have no more unsaved items.
         this->first_unwritten_new_item_index = new_items.size();
@@ -1378,7 +2536,127 @@ bool history_t::save_internal_via_rewrite() {
         this->clear_file_state();
     }
 
-    return ok;
+    return done;
+}
+
+/// Sets out_index to the search index of a rewritten file, made from the index of the file it was
+/// rewritten from and where the items of that went. The rewritten file is mapped at start and has
+/// the given id. Leaves out_index alone if the old index does not fit.
+static void remap_search_index(const history_offset_map_t &offset_map,
+                               const history_search_index_t *old_index, const char *start,
+                               size_t length, file_id_t file_id,
+                               std::shared_ptr<const history_search_index_t> *out_index) {
+    if (old_index == NULL || offset_map.source_file_id.device != old_index->file_id.device ||
+        offset_map.source_file_id.inode != old_index->file_id.inode ||
+        length > std::numeric_limits<uint32_t>::max()) {
+        return;
+    }
+    // The new index covers the items of the new file up to the first one the old index did not
+    // cover, like items that other shells appended meanwhile.
+    history_offset_remap_t remap;
+    std::unordered_set<uint32_t> covered;
+    for (const auto &entry : offset_map.offsets) {
+        if (entry.first < old_index->indexed_length) {
+            remap.insert(entry);
+            covered.insert(entry.second);
+        }
+    }
+    size_t indexed_length = 0;
+    size_t cursor = 0;
+    for (;;) {
+        time_t timestamp = 0;
+        size_t offset = offset_of_next_item_fish_2_0(start, length, &cursor, 0, &timestamp);
+        if (offset == (size_t)-1 || !covered.count((uint32_t)offset)) {
+            indexed_length = offset == (size_t)-1 ? cursor : offset;
+            break;
+        }
+    }
+    for (auto iter = remap.begin(); iter != remap.end();) {
+        iter = iter->second < indexed_length ? std::next(iter) : remap.erase(iter);
+    }
+    if (indexed_length == 0 || remap.empty()) return;
+
+    double start_time = timef();
+    *out_index = old_index->remap(remap, start, length, file_id, indexed_length);
+    debug(2, L"Moved history search index of %lu items to the vacuumed file in %.0f ms",
+          (unsigned long)remap.size(), (timef() - start_time) * 1000);
+}
+
+void history_t::vacuum_in_background() {
+    ASSERT_IS_LOCKED(lock);
+    if (vacuum_in_progress) return;
+    vacuum_in_progress = true;
+
+    // The rewrite works from the file alone, since everything we have is in it already. Then it
+    // maps and scans the new file, so that we don't have to, and moves the search index over to
+    // it.
+    struct vacuum_result_t {
+        bool done = false;
+        time_t boundary_timestamp;
+        std::shared_ptr<const history_search_index_t> old_search_index;
+        const char *mmap_start = NULL;
+        size_t mmap_length = 0;
+        file_id_t file_id = kInvalidFileID;
+        size_t scanned_length = 0;
+        std::deque<size_t> offsets;
+        std::vector<std::pair<size_t, time_t>> deferred;
+        std::shared_ptr<const history_search_index_t> search_index;
+    };
+    std::shared_ptr<vacuum_result_t> result = std::make_shared<vacuum_result_t>();
+    result->boundary_timestamp = boundary_timestamp;
+    if (search_index_is_current()) result->old_search_index = search_index;
+    auto perform = [this, result]() {
+        history_offset_map_t offset_map;
+        result->done = this->rewrite_file(history_item_list_t(), std::set<wcstring>(), true,
+                                          result->old_search_index ? &offset_map : NULL);
+        if (!result->done) return;
+        wcstring filename = history_filename(name, L"");
+        int fd = wopen_cloexec(filename, O_RDONLY);
+        if (fd < 0) return;
+        result->file_id = file_id_for_fd(fd);
+        if (this->map_fd(fd, &result->mmap_start, &result->mmap_length) &&
+            infer_file_type(result->mmap_start, result->mmap_length) == history_type_fish_2_0) {
+            size_t cursor = 0;
+            for (;;) {
+                time_t timestamp = 0;
+                size_t offset = offset_of_next_item_fish_2_0(
+                    result->mmap_start, result->mmap_length, &cursor, 0, &timestamp);
+                if (offset == (size_t)-1) break;
+                if (timestamp == 0 || timestamp <= result->boundary_timestamp) {
+                    result->offsets.push_back(offset);
+                } else {
+                    result->deferred.push_back(std::make_pair(offset, timestamp));
+                }
+            }
+            result->scanned_length = cursor;
+            remap_search_index(offset_map, result->old_search_index.get(),
+                                     result->mmap_start, result->mmap_length, result->file_id,
+                                     &result->search_index);
+        }
+        close(fd);
+    };
+    auto completion = [this, result]() {
+        scoped_lock locker(lock);
+        vacuum_in_progress = false;
+        // Take over the new file, unless it was a different kind or our view of it has moved on.
+        if (result->done && result->scanned_length > 0 &&
+            result->boundary_timestamp == boundary_timestamp) {
+            clear_file_state();
+            mmap_start = result->mmap_start;
+            mmap_length = result->mmap_length;
+            mmap_type = history_type_fish_2_0;
+            mmap_file_id = result->file_id;
+            old_item_offsets.swap(result->offsets);
+            deferred_old_items.swap(result->deferred);
+            old_items_scanned_length = result->scanned_length;
+            loaded_old = true;
+            if (result->search_index) search_index = result->search_index;
+        } else if (result->mmap_start != NULL) {
+            munmap((void *)result->mmap_start, result->mmap_length);
+        }
+        if (result->done) debug(3, L"Vacuumed history file in the background");
+    };
+    iothread_perform(perform, completion);
 }
 
 // Function called to save our unwritten history file by appending to the existing history file
@@ -1426,8 +2704,10 @@ bool history_t::save_internal_via_appending() {
             close(fd);
         } else {
             // File IDs match, so the file we opened is still at that path
-            // We're going to use this fd
-            if (file_id != this->mmap_file_id) {
+            // We're going to use this fd. Other instances appending to it doesn't invalidate our
+            // mapping; only a different file does.
+            if (file_id.device != this->mmap_file_id.device ||
+                file_id.inode != this->mmap_file_id.inode) {
                 file_changed = true;
             }
             history_fd = fd;
@@ -1484,6 +2764,14 @@ bool history_t::save_internal_via_appending() {
         // remains in our new_items
         this->mmap_file_id = file_id_for_fd(history_fd);
 
+        // Index what we appended, while we still hold the lock. The fd is write-only, so the
+        // index is built from another one.
+        int read_fd = wopen_cloexec(history_path, O_RDONLY);
+        if (read_fd >= 0) {
+            if (file_id_for_fd(read_fd) == this->mmap_file_id) this->update_index(read_fd);
+            close(read_fd);
+        }
+
         close(history_fd);
     }
 
@@ -1521,14 +2809,26 @@ void history_t::save_internal(bool vacuum) {
 }
 
 void history_t::save(void) {
+    // Let a background vacuum finish, so that it isn't cut short if we are about to exit.
+    bool vacuuming;
+    {
+        scoped_lock locker(lock);
+        vacuuming = vacuum_in_progress;
+    }
+    if (vacuuming) iothread_drain_all();
+
     scoped_lock locker(lock);
     this->save_internal(false);
+    if (flushes_saved > 0) {
+        debug(2, L"Batching appends to history '%ls' has saved %lu flushes", name.c_str(),
+              (unsigned long)flushes_saved);
+    }
 }
 
-// Formats a single history record, including a trailing newline.  Returns true
-// if bytes were written to the output stream and false otherwise.
+// Formats a single history record, including a trailing newline, into out. Returns true if
+// successful and false otherwise.
 static bool format_history_record(const history_item_t &item, const wchar_t *show_time_format,
-                                  bool null_terminate, io_streams_t &streams) {
+                                  bool null_terminate, wcstring *out) {
     if (show_time_format) {
         const time_t seconds = item.timestamp();
         struct tm timestamp;
@@ -1538,20 +2838,310 @@ static bool format_history_record(const history_item_t &item, const wchar_t *sho
         if (std::wcsftime(timestamp_string, max_tstamp_length, show_time_format, &timestamp) == 0) {
             return false;
         }
-        streams.out.append(timestamp_string);
+        out->append(timestamp_string);
     }
-    streams.out.append(item.str());
+    out->append(item.str());
     if (null_terminate) {
-        streams.out.append(L'\0');
+        out->push_back(L'\0');
     } else {
-        streams.out.append(L'\n');
+        out->push_back(L'\n');
+    }
+    return true;
+}
+
+// Formats a single history record, including a trailing newline.  Returns true
+// if bytes were written to the output stream and false otherwise.
+static bool format_history_record(const history_item_t &item, const wchar_t *show_time_format,
+                                  bool null_terminate, io_streams_t &streams) {
+    wcstring record;
+    if (!format_history_record(item, show_time_format, null_terminate, &record)) return false;
+    streams.out.append(record);
+    return true;
+}
+
+/// A match found by a parallel history search.
+struct parallel_search_match_t {
+    // The contents of the matching item, used to skip duplicates.
+    wcstring contents;
+    // The formatted record, if formatting succeeded.
+    wcstring record;
+    bool formatted;
+    // Set instead for an item that failed to decode, which ends the search like it does for
+    // history_search_t.
+    bool end;
+};
+
+/// State shared between a parallel history search and its worker threads. The old items are split
+/// into chunks of consecutive items, most recent first, which are claimed in order by whichever
+/// thread is free, including the searching thread itself.
+struct parallel_search_t {
+    // Read only once the workers have started.
+    const char *mmap_start;
+    size_t mmap_length;
+    history_file_type_t mmap_type;
+    std::vector<size_t> offsets;
+    wcstring term;
+    history_search_type_t search_type;
+    bool case_sensitive;
+    bool has_time_format;
+    wcstring show_time_format;
+    bool null_terminate;
+    size_t chunk_size;
+    size_t chunk_count;
+
+    // Protected by lock, and signalled through cond whenever a chunk is done or a worker exits.
+    mutex_lock_t lock;
+    pthread_cond_t cond;
+    size_t next_chunk = 0;
+    size_t running_workers = 0;
+    bool stopped = false;
+    std::vector<std::vector<parallel_search_match_t>> results;
+    std::vector<bool> done;
+
+    parallel_search_t() { VOMIT_ON_FAILURE(pthread_cond_init(&cond, NULL)); }
+    ~parallel_search_t() { VOMIT_ON_FAILURE(pthread_cond_destroy(&cond)); }
+
+    /// Decodes and matches the items of a chunk, without the lock.
+    void search_chunk(size_t chunk, std::vector<parallel_search_match_t> *out) const {
+        const wchar_t *time_format = has_time_format ? show_time_format.c_str() : NULL;
+        const size_t end = offsets.size() - chunk * chunk_size;
+        const size_t begin = end > chunk_size ? end - chunk_size : 0;
+        for (size_t i = end; i-- > begin;) {
+            const size_t offset = offsets[i];
+            const history_item_t item =
+                decode_item(mmap_start + offset, mmap_length - offset, mmap_type);
+            parallel_search_match_t match;
+            match.end = item.empty();
+            if (match.end || item.matches_search(term, search_type, case_sensitive)) {
+                match.contents = item.str();
+                match.formatted =
+                    !match.end &&
+                    format_history_record(item, time_format, null_terminate, &match.record);
+                const bool end = match.end;
+                out->push_back(std::move(match));
+                if (end) break;
+            }
+        }
+    }
+
+    /// Claims and searches chunks until there are none left or the search is stopped. Called with
+    /// the lock held. Returns after searching a single chunk if only_one is set.
+    void claim_chunks(scoped_lock &locker, bool only_one) {
+        while (!stopped && next_chunk < chunk_count) {
+            const size_t chunk = next_chunk++;
+            std::vector<parallel_search_match_t> matches;
+            locker.unlock();
+            search_chunk(chunk, &matches);
+            locker.lock();
+            results[chunk].swap(matches);
+            done[chunk] = true;
+            VOMIT_ON_FAILURE(pthread_cond_broadcast(&cond));
+            if (only_one) break;
+        }
+    }
+
+    /// The body of a worker thread.
+    static void work(const std::shared_ptr<parallel_search_t> &search) {
+        scoped_lock locker(search->lock);
+        search->running_workers++;
+        search->claim_chunks(locker, false);
+        search->running_workers--;
+        VOMIT_ON_FAILURE(pthread_cond_broadcast(&search->cond));
+    }
+};
+
+/// Returns the number of threads a parallel history search should use.
+static size_t parallel_search_thread_count() {
+    const long max_threads = 8;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1) cpus = 1;
+    return (size_t)std::min(cpus, max_threads);
+}
+
+bool history_t::search_term(const wcstring &term, history_search_type_t search_type,
+                            bool case_sensitive, const wchar_t *show_time_format,
+                            bool null_terminate, long *max_items, io_streams_t &streams,
+                            bool *out_stop) {
+    *out_stop = false;
+    const size_t chunk_size = 1024;
+    const size_t thread_count = parallel_search_thread_count();
+    std::shared_ptr<parallel_search_t> search;
+    size_t resolved_new_item_count = 0;
+    if (is_main_thread()) {
+        // Old items only change on the main thread, so the workers can read them without the lock
+        // while we wait for them below.
+        scoped_lock locker(lock);
+        load_old_if_needed();
+        if (old_item_offsets.size() > chunk_size) {
+            search = std::make_shared<parallel_search_t>();
+            search->mmap_start = mmap_start;
+            search->mmap_length = mmap_length;
+            search->mmap_type = mmap_type;
+            search->offsets.assign(old_item_offsets.begin(), old_item_offsets.end());
+            resolved_new_item_count = new_items.size();
+            if (this->has_pending_item && resolved_new_item_count > 0) {
+                resolved_new_item_count -= 1;
+            }
+        }
+    }
+
+    if (!search) {
+        history_search_t searcher = history_search_t(*this, term, search_type, case_sensitive);
+        while (searcher.go_backwards()) {
+            if (!format_history_record(searcher.current_item(), show_time_format, null_terminate,
+                                       streams)) {
+                return false;
+            }
+            if (--*max_items == 0) {
+                *out_stop = true;
+                return true;
+            }
+        }
+        return true;
+    }
+
+    // The new items are few and already decoded, so check them here. Like history_search_t, skip
+    // items that match the same as an earlier one.
+    std::set<wcstring> seen;
+    bool keep_going = true;
+    for (size_t idx = 1; idx <= resolved_new_item_count && keep_going; idx++) {
+        const history_item_t item = item_at_index(idx);
+        if (item.empty()) return true;
+        if (!item.matches_search(term, search_type, case_sensitive)) continue;
+        if (!seen.insert(item.str()).second) continue;
+        if (!format_history_record(item, show_time_format, null_terminate, streams)) return false;
+        if (--*max_items == 0) {
+            *out_stop = true;
+            return true;
+        }
+        keep_going = !reader_interrupted();
+    }
+    if (!keep_going) return true;
+
+    search->term = term;
+    search->search_type = search_type;
+    search->case_sensitive = case_sensitive;
+    search->has_time_format = show_time_format != NULL;
+    if (show_time_format) search->show_time_format = show_time_format;
+    search->null_terminate = null_terminate;
+    search->chunk_size = chunk_size;
+    search->chunk_count = (search->offsets.size() + chunk_size - 1) / chunk_size;
+    search->results.resize(search->chunk_count);
+    search->done.resize(search->chunk_count);
+    for (size_t i = 1; i < thread_count && i < search->chunk_count; i++) {
+        iothread_perform([search]() { parallel_search_t::work(search); });
+    }
+
+    // Write the matches out chunk by chunk, in order. Rather than waiting for the next chunk, help
+    // with the remaining ones; this also guarantees progress if the workers are slow to start.
+    bool result = true;
+    scoped_lock locker(search->lock);
+    for (size_t chunk = 0; chunk < search->chunk_count && keep_going; chunk++) {
+        while (!search->done[chunk]) {
+            if (search->next_chunk < search->chunk_count) {
+                search->claim_chunks(locker, true);
+            } else {
+                VOMIT_ON_FAILURE(pthread_cond_wait(&search->cond, &search->lock.mutex));
+            }
+        }
+        std::vector<parallel_search_match_t> matches;
+        matches.swap(search->results[chunk]);
+        locker.unlock();
+        for (size_t i = 0; i < matches.size() && keep_going; i++) {
+            const parallel_search_match_t &match = matches[i];
+            if (match.end) {
+                keep_going = false;
+            } else if (!seen.insert(match.contents).second) {
+                continue;
+            } else if (!match.formatted) {
+                result = false;
+                keep_going = false;
+            } else {
+                streams.out.append(match.record);
+                if (--*max_items == 0) {
+                    *out_stop = true;
+                    keep_going = false;
+                }
+            }
+        }
+        if (keep_going && reader_interrupted()) keep_going = false;
+        locker.lock();
+    }
+
+    // Wait for the workers that are still searching, since the old items may change once we
+    // return. Workers that have not started yet will find the search stopped.
+    search->stopped = true;
+    while (search->running_workers > 0) {
+        VOMIT_ON_FAILURE(pthread_cond_wait(&search->cond, &search->lock.mutex));
+    }
+    return result;
+}
+
+bool history_t::search_time_range(history_search_type_t search_type,
+                                  const wcstring_list_t &search_args, bool case_sensitive,
+                                  time_t since, time_t until, const wchar_t *show_time_format,
+                                  bool null_terminate, long max_items, io_streams_t &streams) {
+    for (const wcstring &search_string : search_args) {
+        if (search_string.empty()) {
+            streams.err.append_format(L"Searching for the empty string isn't allowed");
+            return false;
+        }
+    }
+
+    // The candidates are the resolved new items, and the old items whose timestamps the time index
+    // can't rule out. Old items only change on the main thread, so we can decode them as we go.
+    ASSERT_IS_MAIN_THREAD();
+    history_item_list_t new_candidates;
+    std::vector<size_t> old_candidates;
+    {
+        scoped_lock locker(lock);
+        size_t resolved_new_item_count = new_items.size();
+        if (this->has_pending_item && resolved_new_item_count > 0) {
+            resolved_new_item_count -= 1;
+        }
+        new_candidates.assign(new_items.begin(), new_items.begin() + resolved_new_item_count);
+
+        load_old_if_needed();
+        size_t begin, end;
+        old_items_in_time_range(since, until, &begin, &end);
+        old_candidates.assign(old_item_offsets.begin() + begin, old_item_offsets.begin() + end);
+    }
+
+    // Like the other searches, each term reports an item only once, but without terms we write
+    // everything. Go from the most recent item to the least, i.e. from the last new item to the
+    // first old one.
+    const wcstring_list_t all_items(1);
+    const wcstring_list_t &terms = search_args.empty() ? all_items : search_args;
+    const size_t old_count = old_candidates.size();
+    for (const wcstring &term : terms) {
+        std::set<wcstring> seen;
+        for (size_t i = old_count + new_candidates.size(); i-- > 0;) {
+            size_t offset = i < old_count ? old_candidates[i] : 0;
+            const history_item_t item =
+                i < old_count ? decode_item(mmap_start + offset, mmap_length - offset, mmap_type)
+                              : new_candidates[i - old_count];
+            if (item.timestamp() < since || item.timestamp() > until) continue;
+            if (!term.empty()) {
+                if (!item.matches_search(term, search_type, case_sensitive)) continue;
+                if (!seen.insert(item.str()).second) continue;
+            }
+            if (!format_history_record(item, show_time_format, null_terminate, streams)) {
+                return false;
+            }
+            if (--max_items == 0) return true;
+        }
     }
     return true;
 }
 
 bool history_t::search(history_search_type_t search_type, wcstring_list_t search_args,
                        const wchar_t *show_time_format, long max_items, bool case_sensitive,
-                       bool null_terminate, io_streams_t &streams) {
+                       bool null_terminate, io_streams_t &streams, time_t since, time_t until) {
+    if (since != 0 || until != std::numeric_limits<time_t>::max()) {
+        return search_time_range(search_type, search_args, case_sensitive, since, until,
+                                 show_time_format, null_terminate, max_items, streams);
+    }
+
     // scoped_lock locker(lock);
     if (search_args.empty()) {
         // Start at one because zero is the current command.
@@ -1571,15 +3161,12 @@ bool history_t::search(history_search_type_t search_type, wcstring_list_t search
             streams.err.append_format(L"Searching for the empty string isn't allowed");
             return false;
         }
-        history_search_t searcher =
-            history_search_t(*this, search_string, search_type, case_sensitive);
-        while (searcher.go_backwards()) {
-            if (!format_history_record(searcher.current_item(), show_time_format, null_terminate,
-                                       streams)) {
-                return false;
-            }
-            if (--max_items == 0) return true;
+        bool stop = false;
+        if (!search_term(search_string, search_type, case_sensitive, show_time_format,
+                         null_terminate, &max_items, streams, &stop)) {
+            return false;
         }
+        if (stop) return true;
     }
 
     return true;
@@ -1599,6 +3186,14 @@ void history_t::enable_automatic_saving() {
 }
 
 void history_t::clear(void) {
+    // A vacuum still in flight would bring back what we're about to delete.
+    bool vacuuming;
+    {
+        scoped_lock locker(lock);
+        vacuuming = vacuum_in_progress;
+    }
+    if (vacuuming) iothread_drain_all();
+
     scoped_lock locker(lock);
     new_items.clear();
     deleted_items.clear();
@@ -1606,6 +3201,8 @@ void history_t::clear(void) {
     old_item_offsets.clear();
     wcstring filename = history_filename(name, L"");
     if (!filename.empty()) wunlink(filename);
+    wcstring index_path = history_filename(name, L".idx");
+    if (!index_path.empty()) wunlink(index_path);
     this->clear_file_state();
 }
 
@@ -1725,10 +3322,9 @@ void history_t::populate_from_bash(FILE *stream) {
 
 void history_t::incorporate_external_changes() {
     // To incorporate new items, we simply update our timestamp to now, so that items from previous
-    // instances get added. We then clear the file state so that we remap the file. Note that this
-    // is somehwhat expensive because we will be going back over old items. An optimization would be
-    // to preserve old_item_offsets so that they don't have to be recomputed. (However, then items
-    // *deleted* in other instances would not show up here).
+    // instances get added. If the file has only been appended to, we keep old_item_offsets and
+    // just scan the new part. Otherwise (say, items were *deleted* in other instances, which
+    // rewrites the file) we clear the file state so that we remap and rescan the file.
     time_t new_timestamp = time(NULL);
     scoped_lock locker(lock);
 
@@ -1736,7 +3332,6 @@ void history_t::incorporate_external_changes() {
     // we only do work if time has progressed. This also makes multiple calls cheap.
     if (new_timestamp > this->boundary_timestamp) {
         this->boundary_timestamp = new_timestamp;
-        this->clear_file_state();
 
         // We also need to erase new_items, since we go through those first, and that means we
         // will not properly interleave them with items from other instances.
@@ -1744,10 +3339,30 @@ void history_t::incorporate_external_changes() {
         this->save_internal(false);
         this->new_items.clear();
         this->first_unwritten_new_item_index = 0;
+        if (!this->incorporate_appended_items()) this->clear_file_state();
     }
 }
 
-void history_init() {}
+/// Returns the value of a flush policy variable, or the given default if it's unset or invalid.
+static long flush_policy_value(const wchar_t *var_name, long min_value, long default_value) {
+    env_var_t var = env_get_string(var_name);
+    if (var.missing_or_empty()) return default_value;
+
+    long value = fish_wcstol(var.c_str());
+    if (errno || value < min_value) {
+        fwprintf(stderr, L"ignoring %ls: value '%ls' is not an integer or is < %ld\n", var_name,
+                 var.c_str(), min_value);
+        return default_value;
+    }
+    return value;
+}
+
+void update_history_flush_policy() {
+    s_flush_max_items = (size_t)flush_policy_value(L"fish_history_flush_items", 1, 1);
+    s_flush_max_delay_ms = flush_policy_value(L"fish_history_flush_delay_ms", 0, 0);
+}
+
+void history_init() { update_history_flush_policy(); }
 
 void history_collection_t::save() {
     // Save all histories
@@ -1759,25 +3374,90 @@ void history_collection_t::save() {
 
 void history_destroy() { histories.save(); }
 
+double history_collection_t::next_flush_time() {
+    double result = 0;
+    auto h = histories.acquire();
+    for (auto &p : h.value) {
+        double when = p.second->next_flush_time();
+        if (when > 0 && (result == 0 || when < result)) result = when;
+    }
+    return result;
+}
+
+void history_collection_t::save_due() {
+    auto h = histories.acquire();
+    for (auto &p : h.value) {
+        p.second->save_if_due();
+    }
+}
+
+long history_usec_until_flush() {
+    double when = histories.next_flush_time();
+    if (when == 0) return -1;
+    // Wake up at least once an hour, which keeps long delays from overflowing.
+    double usec = (when - timef()) * 1E6;
+    return usec <= 0 ? 0 : (long)std::min(usec, 3600 * 1E6);
+}
+
+void history_save_due_items() { histories.save_due(); }
+
 void history_sanity_check() {
     // No sanity checking implemented yet...
 }
 
+/// Gets the status of paths the way path_is_valid judges them. The special paths . and .. are
+/// decided without looking at the filesystem, and the others are checked together by
+/// path_get_statuses.
+static std::vector<path_status_t> get_path_statuses(const path_list_t &paths,
+                                                    const wcstring &working_directory,
+                                                    long timeout_msec, bool stop_at_missing) {
+    std::vector<path_status_t> result(paths.size(), PATH_STATUS_UNKNOWN);
+    wcstring_list_t abs_paths;
+    std::vector<size_t> abs_path_indexes;
+    for (size_t i = 0; i < paths.size(); i++) {
+        const wcstring &path = paths.at(i);
+        if (path.empty()) {
+            result.at(i) = PATH_STATUS_MISSING;
+        } else if (path == L"." || path == L"./") {
+            result.at(i) = PATH_STATUS_DIRECTORY;
+        } else if (path == L".." || path == L"../") {
+            bool has_parent = !working_directory.empty() && working_directory != L"/";
+            result.at(i) = has_parent ? PATH_STATUS_DIRECTORY : PATH_STATUS_MISSING;
+        } else {
+            abs_paths.push_back(path.at(0) == L'/' ? path : working_directory + path);
+            abs_path_indexes.push_back(i);
+        }
+        if (stop_at_missing && result.at(i) == PATH_STATUS_MISSING) return result;
+    }
+
+    std::vector<path_status_t> statuses =
+        path_get_statuses(abs_paths, timeout_msec, stop_at_missing);
+    for (size_t i = 0; i < statuses.size(); i++) {
+        result.at(abs_path_indexes.at(i)) = statuses.at(i);
+    }
+    return result;
+}
+
 path_list_t valid_paths(const path_list_t &paths, const wcstring &working_directory) {
     ASSERT_IS_BACKGROUND_THREAD();
+    // The result is remembered with the history item, so wait for every check.
+    std::vector<path_status_t> statuses = get_path_statuses(paths, working_directory, -1, false);
     wcstring_list_t result;
-    for (const wcstring &path : paths) {
-        if (path_is_valid(path, working_directory)) {
-            result.push_back(path);
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (statuses.at(i) == PATH_STATUS_DIRECTORY || statuses.at(i) == PATH_STATUS_OTHER) {
+            result.push_back(paths.at(i));
         }
     }
     return result;
 }
 
-bool all_paths_are_valid(const path_list_t &paths, const wcstring &working_directory) {
+bool all_paths_are_valid(const path_list_t &paths, const wcstring &working_directory,
+                         long timeout_msec) {
     ASSERT_IS_BACKGROUND_THREAD();
-    for (const wcstring &path : paths) {
-        if (!path_is_valid(path, working_directory)) {
+    std::vector<path_status_t> statuses =
+        get_path_statuses(paths, working_directory, timeout_msec, true);
+    for (path_status_t status : statuses) {
+        if (status != PATH_STATUS_DIRECTORY && status != PATH_STATUS_OTHER) {
             return false;
         }
     }
@@ -9,6 +9,7 @@
 #include <time.h>
 #include <wctype.h>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <set>
 #include <string>
@@ -59,9 +60,10 @@ class history_item_t {
     // Attempts to merge two compatible history items together.
     bool merge(const history_item_t &item);
 
-    // The actual contents of the entry.
-    wcstring contents;        // value as entered by the user
-    wcstring contents_lower;  // value normalized to all lowercase for case insensitive comparisons
+    // The actual contents of the entry, as entered by the user. This is stored as UTF-8 (extended
+    // to cover every wchar_t, see history.cpp), which is a quarter of the size of a wcstring for
+    // typical commands. Case insensitive searches fold case as they compare.
+    std::string contents;
 
     // Original creation time for the entry.
     time_t creation_timestamp;
@@ -69,14 +71,15 @@ class history_item_t {
     // Sometimes unique identifier used for hinting.
     history_identifier_t identifier;
 
-    // Paths that we require to be valid for this item to be autosuggested.
-    path_list_t required_paths;
+    // Paths that we require to be valid for this item to be autosuggested. Copies of an item share
+    // the list. Null if there are no paths.
+    std::shared_ptr<const path_list_t> required_paths;
 
    public:
     explicit history_item_t(const wcstring &str, time_t when = 0, history_identifier_t ident = 0);
 
-    const wcstring &str() const { return contents; }
-    const wcstring &str_lower() const { return contents_lower; }
+    wcstring str() const;
+    wcstring str_lower() const;
 
     bool empty() const { return contents.empty(); }
 
@@ -86,17 +89,22 @@ class history_item_t {
 
     time_t timestamp() const { return creation_timestamp; }
 
-    const path_list_t &get_required_paths() const { return required_paths; }
-    void set_required_paths(path_list_t paths) { required_paths = paths; }
+    const path_list_t &get_required_paths() const;
+    void set_required_paths(path_list_t paths);
 
     bool operator==(const history_item_t &other) const {
         return contents == other.contents && creation_timestamp == other.creation_timestamp &&
-               required_paths == other.required_paths;
+               get_required_paths() == other.get_required_paths();
     }
 };
 
 typedef std::deque<history_item_t> history_item_list_t;
 
+class history_search_index_t;
+struct history_offset_map_t;
+class history_item_cache_t;
+class history_time_index_t;
+
 // The type of file that we mmap'd.
 enum history_file_type_t { history_type_unknown, history_type_fish_2_0, history_type_fish_1_x };
 
@@ -136,6 +144,16 @@ class history_t {
     // Whether we should disable saving to the file for a time.
     uint32_t disable_automatic_save_counter;
 
+    // When the oldest unwritten item was added, as returned by timef().
+    double oldest_unwritten_item_time;
+
+    // How many automatic saves were folded into a later one by the flush policy.
+    size_t flushes_saved;
+
+    // Whether the flush policy lets the unwritten items wait for a later save.
+    bool can_defer_save() const;
+
+
     // Deleted item contents.
     std::set<wcstring> deleted_items;
 
@@ -160,15 +178,101 @@ class history_t {
     // How many items we add until the next vacuum. Initially a random value.
     int countdown_to_vacuum;
 
+    // Whether a vacuum is running on a background thread.
+    bool vacuum_in_progress;
+
     // Figure out the offsets of our mmap data.
     void populate_from_mmap(void);
 
+    // Figure out the offsets of our mmap data from the index file, scanning any items that were
+    // appended since it was written. Only reads the index. Returns false if it could not be used.
+    bool populate_from_index(void);
+
+    // Brings the index of the history file open in fd up to date, indexing the items past what it
+    // covers, or all of them if it describes another file. Called with the history file locked for
+    // writing.
+    void update_index(int fd) const;
+
     // List of old items, as offsets into out mmap data.
     std::deque<size_t> old_item_offsets;
 
+    // How much of a fish 2.0 file has been scanned for old items, and the items in that part that
+    // were left out because they are newer than boundary_timestamp, as offset and timestamp. These
+    // let incorporate_external_changes scan only what was appended to the file.
+    size_t old_items_scanned_length;
+    std::vector<std::pair<size_t, time_t>> deferred_old_items;
+
+    // Adds an item found by scanning the file to the old items, or defers it if it is newer than
+    // boundary_timestamp.
+    void add_scanned_item(size_t offset, time_t timestamp);
+
+    // If the history file has only been appended to since it was mapped, maps it again and adds
+    // the items that are now old without scanning the part already scanned, and returns true.
+    // Otherwise returns false, and the file has to be reloaded.
+    bool incorporate_appended_items(void);
+
     // Whether we've loaded old items.
     bool loaded_old;
 
+    // Recently decoded old items, keyed by offset, and how often we found an item there or not.
+    // Cleared along with the mapping.
+    std::unique_ptr<history_item_cache_t> item_cache;
+    size_t item_cache_hits;
+    size_t item_cache_misses;
+
+    // Returns the old item at the given offset, decoding it if it isn't in the cache.
+    history_item_t decode_old_item(size_t offset);
+
+    // Bounds on the timestamps of the old items, built when first needed and rebuilt when the old
+    // items change.
+    std::unique_ptr<history_time_index_t> time_index;
+
+    // Narrows the range of old_item_offsets indexes [*out_begin, *out_end) to the items that may
+    // have been created between since and until (inclusive), using the time index.
+    void old_items_in_time_range(time_t since, time_t until, size_t *out_begin,
+                                 size_t *out_end);
+
+    // Searches the items created between since and until (inclusive) on behalf of search(). With
+    // no search terms, writes all of them.
+    bool search_time_range(history_search_type_t search_type, const wcstring_list_t &search_args,
+                           bool case_sensitive, time_t since, time_t until,
+                           const wchar_t *show_time_format, bool null_terminate, long max_items,
+                           io_streams_t &streams);
+
+    // Incremented whenever old_item_offsets is cleared, so that an index of old items can tell
+    // that it is stale.
+    uint64_t old_items_generation;
+
+    // Trigram and prefix indexes of the old items, used to speed up contains and prefix searches.
+    // They are built in the background, and refer to the items by their offsets in the history
+    // file, so they stay valid while the file is only appended to.
+    std::shared_ptr<const history_search_index_t> search_index;
+    bool search_index_building;
+    bool search_index_abandoned;
+
+    // Returns whether the search index describes the start of the mapped file.
+    bool search_index_is_current() const;
+
+    // Returns the position in old_item_offsets of the first old item that the current search index
+    // does not cover.
+    size_t first_unindexed_old_item() const;
+
+    // Sets out_indexes to the indexes of the new items, followed by those of the old items at the
+    // given positions, which are decreasing.
+    void get_candidate_indexes(const std::vector<size_t> &positions,
+                               std::vector<size_t> *out_indexes) const;
+
+    // Builds the search index, or extends it by the items appended since, unless there are fewer
+    // than min_items old items. Runs on a background thread.
+    void build_search_index(size_t min_items = 0);
+
+    // Searches for a single term on behalf of search(), decrementing max_items for each match
+    // written. Sets out_stop if max_items ran out. Returns false if a record could not be
+    // formatted.
+    bool search_term(const wcstring &term, history_search_type_t search_type, bool case_sensitive,
+                     const wchar_t *show_time_format, bool null_terminate, long *max_items,
+                     io_streams_t &streams, bool *out_stop);
+
     // Loads old if necessary.
     bool load_old_if_needed(void);
 
@@ -178,13 +282,28 @@ class history_t {
     // Deletes duplicates in new_items.
     void compact_new_items();
 
-    // Attempts to rewrite the existing file to a target temporary file
+    // Attempts to rewrite the existing file to a target temporary file, leaving out the deleted
+    // items and adding the extra items. If out_offsets is not NULL, it is set to where the items
+    // of the existing file went.
     // Returns false on error, true on success
-    bool rewrite_to_temporary_file(int tmp_fd, int existing_fd) const;
+    bool rewrite_to_temporary_file(int existing_fd, int dst_fd,
+                                   const history_item_list_t &extra_items,
+                                   const std::set<wcstring> &deleted,
+                                   history_offset_map_t *out_offsets = NULL) const;
+
+    // Rewrites the history file as rewrite_to_temporary_file does, and returns whether it was
+    // replaced. If require_existing is set, gives up if there is no history file, or if it goes
+    // away meanwhile. Only uses the name, so it does not need the lock.
+    bool rewrite_file(const history_item_list_t &extra_items, const std::set<wcstring> &deleted,
+                      bool require_existing, history_offset_map_t *out_offsets = NULL) const;
 
     // Saves history by rewriting the file.
     bool save_internal_via_rewrite();
 
+    // Starts rewriting the history file on a background thread, unless that is already happening.
+    // All new items must have been written. Once done, the rewritten file replaces our mapping.
+    void vacuum_in_background();
+
     // Saves history by appending to the file.
     bool save_internal_via_appending();
 
@@ -235,10 +354,18 @@ class history_t {
     // Saves history.
     void save();
 
-    // Searches history.
+    // When the unwritten items are due to be saved under fish_history_flush_delay_ms, as returned
+    // by timef(), or 0 if nothing is waiting for the delay.
+    double next_flush_time();
+
+    // Saves the unwritten items if the flush policy no longer lets them wait.
+    void save_if_due();
+
+    // Searches history. Only items created between since and until (inclusive) are considered.
     bool search(history_search_type_t search_type, wcstring_list_t search_args,
                 const wchar_t *show_time_format, long max_items, bool case_sensitive,
-                bool null_terminate, io_streams_t &streams);
+                bool null_terminate, io_streams_t &streams, time_t since = 0,
+                time_t until = std::numeric_limits<time_t>::max());
 
     // Enable / disable automatic saving. Main thread only!
     void disable_automatic_saving();
@@ -260,12 +387,37 @@ class history_t {
     // environment variable. This may be long!
     void get_string_representation(wcstring *result, const wcstring &separator);
 
+    // Gets the distinct history items, most recent first, as in the $history variable. Stops after
+    // max_count items, so that only as much of the history as needed is decoded.
+    void get_unique_items(wcstring_list_t *result, size_t max_count = (size_t)-1);
+
     // Sets the valid file paths for the history item with the given identifier.
     void set_valid_file_paths(const wcstring_list_t &valid_file_paths, history_identifier_t ident);
 
     // Return the specified history at the specified index. 0 is the index of the current
     // commandline. (So the most recent item is at index 1.)
     history_item_t item_at_index(size_t idx);
+
+    // Returns how many lookups of old items were answered from the cache of decoded items, and
+    // how many were not. Useful for tuning the cache size.
+    void get_item_cache_stats(size_t *out_hits, size_t *out_misses);
+
+    // Starts building the index used to speed up contains and prefix searches in the background,
+    // or extending it by the items appended since, unless it is being built or is not needed.
+    // Small histories are searched without an index.
+    void build_search_index_in_background(void);
+
+    // If the search index is built, sets out_indexes to the indexes (as in item_at_index) of the
+    // items that may contain the given lowercase term, in increasing order, and returns true.
+    // Otherwise returns false, and every item has to be checked.
+    bool get_contains_candidates(const wcstring &lterm, std::vector<size_t> *out_indexes);
+
+    // If the search index is built, sets out_indexes to the indexes of the items that may start
+    // with the given prefix (case sensitively), in increasing order, and returns true. At most
+    // max_count old items are returned, the most recent ones; out_complete is set to whether that
+    // was all of them. Otherwise returns false, and every item has to be checked.
+    bool get_prefix_candidates(const wcstring &prefix, size_t max_count,
+                               std::vector<size_t> *out_indexes, bool *out_complete);
 };
 
 class history_search_t {
@@ -292,6 +444,19 @@ class history_search_t {
 
     bool should_skip_match(const wcstring &str) const;
 
+    // For contains and case sensitive prefix searches, the indexes of the items that may match,
+    // from the history's search index, if it was built when the search started. Prefix searches
+    // fetch the candidates in batches of increasing size, since they usually stop at the first
+    // match; candidates_complete is set once there are no more.
+    std::vector<size_t> candidates;
+    size_t candidate_limit = 16;
+    bool checked_candidates = false;
+    bool has_candidates = false;
+    bool candidates_complete = false;
+
+    // Fetches the candidates from the history.
+    void update_candidates(void);
+
    public:
     // Gets the search term.
     const wcstring &get_term() const { return term; }
@@ -345,6 +510,19 @@ void history_init();
 // Saves the new history to disk.
 void history_destroy();
 
+// Returns how many microseconds until the new items of some history are due to be written by
+// history_save_due_items, or -1 if no items are waiting for fish_history_flush_delay_ms.
+long history_usec_until_flush();
+
+// Writes the new items whose fish_history_flush_delay_ms is up. The reader calls this while it
+// waits for input, so that idle shells write them too.
+void history_save_due_items();
+
+// Update how many new items, and for how long, may be held back before they are appended to the
+// history file, in response to the fish_history_flush_items and fish_history_flush_delay_ms
+// variables.
+void update_history_flush_policy();
+
 // Perform sanity checks.
 void history_sanity_check();
 
@@ -355,5 +533,7 @@ path_list_t valid_paths(const path_list_t &paths, const wcstring &working_direct
 // Given a list of paths and a working directory,
 // return true if all paths in the list are valid
 // Returns true for if paths is empty
-bool all_paths_are_valid(const path_list_t &paths, const wcstring &working_directory);
+// If timeout_msec is not negative, paths that take longer than that to check count as invalid
+bool all_paths_are_valid(const path_list_t &paths, const wcstring &working_directory,
+                         long timeout_msec = -1);
 #endif
@@ -22,6 +22,7 @@
 #include "env.h"
 #include "env_universal_common.h"
 #include "fallback.h"  // IWYU pragma: keep
+#include "history.h"
 #include "input_common.h"
 #include "iothread.h"
 #include "util.h"
@@ -101,14 +102,24 @@ static wint_t readb() {
 
         // Get its suggested delay (possibly none).
         struct timeval tv = {};
-        const unsigned long usecs_delay = notifier.usec_delay_between_polls();
-        if (usecs_delay > 0) {
+        unsigned long usecs_delay = notifier.usec_delay_between_polls();
+        bool has_timeout = usecs_delay > 0;
+
+        // Wake up when history items waiting for fish_history_flush_delay_ms are due.
+        history_save_due_items();
+        const long usecs_until_flush = history_usec_until_flush();
+        if (usecs_until_flush >= 0 &&
+            (!has_timeout || (unsigned long)usecs_until_flush < usecs_delay)) {
+            usecs_delay = usecs_until_flush;
+            has_timeout = true;
+        }
+        if (has_timeout) {
             unsigned long usecs_per_sec = 1000000;
             tv.tv_sec = (int)(usecs_delay / usecs_per_sec);
             tv.tv_usec = (int)(usecs_delay % usecs_per_sec);
         }
 
-        res = select(fd_max + 1, &fdset, 0, 0, usecs_delay > 0 ? &tv : NULL);
+        res = select(fd_max + 1, &fdset, 0, 0, has_timeout ? &tv : NULL);
         if (res == -1) {
             if (errno == EINTR || errno == EAGAIN) {
                 if (interrupt_handler) {
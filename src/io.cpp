@@ -5,8 +5,12 @@
 #include <errno.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <wchar.h>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 #include "common.h"
 #include "exec.h"
@@ -14,8 +18,113 @@
 #include "io.h"
 #include "wutil.h"  // IWYU pragma: keep
 
+/// The size of the first chunk read by an input_stream_t. This is small, so that a builtin reading
+/// one line from a seekable fd does not read (and seek back over) much more than it needs. Bash
+/// uses 128 bytes for the same purpose.
+#define INPUT_STREAM_INITIAL_CHUNK 128
+
+/// The largest chunk read by an input_stream_t.
+#define INPUT_STREAM_MAX_CHUNK (64 * 1024)
+
 io_data_t::~io_data_t() {}
 
+void output_stream_t::flush() {
+    if (stream_fd_ < 0 || buffer_.empty()) return;
+    if (!write_failed_) {
+        const std::string narrow = wcs2string(buffer_);
+        size_t written = 0;
+        while (written < narrow.size()) {
+            ssize_t amt = write(stream_fd_, narrow.data() + written, narrow.size() - written);
+            if (amt >= 0) {
+                written += amt;
+            } else if (errno == EAGAIN && stream_wait_ && stream_wait_(stream_fd_)) {
+                continue;
+            } else if (errno == EAGAIN) {
+                // Give up on streaming. str2wcstring encodes bytes that are not valid in the
+                // locale, so the rest converts back to the same bytes even if a character was
+                // split.
+                buffer_ = str2wcstring(narrow.data() + written, narrow.size() - written);
+                stream_fd_ = -1;
+                return;
+            } else if (errno != EINTR) {
+                // A closed pipe is the usual way for the reader to say it wants no more, so only
+                // report other errors.
+                if (errno != EPIPE) wperror(L"write");
+                write_failed_ = true;
+                break;
+            }
+        }
+    }
+    buffer_.clear();
+}
+
+input_stream_t::input_stream_t(int fd, bool exclusive)
+    : fd_(fd),
+      seekable_(fd >= 0 && !isatty(fd) && lseek(fd, 0, SEEK_CUR) != -1),
+      can_read_ahead_(exclusive || seekable_),
+      eof_(false),
+      pos_(0),
+      chunk_size_(INPUT_STREAM_INITIAL_CHUNK) {}
+
+bool input_stream_t::fill() {
+    if (eof_) return false;
+
+    // Discard what has been consumed.
+    buffer_.erase(buffer_.begin(), buffer_.begin() + pos_);
+    pos_ = 0;
+
+    size_t amt = can_read_ahead_ ? chunk_size_ : 1;
+    size_t old_size = buffer_.size();
+    buffer_.resize(old_size + amt);
+    ssize_t res;
+    do {
+        res = read(fd_, &buffer_[old_size], amt);
+    } while (res < 0 && errno == EINTR);
+    buffer_.resize(old_size + (res > 0 ? res : 0));
+
+    if (res <= 0) {
+        eof_ = true;
+        return false;
+    }
+    if (chunk_size_ < INPUT_STREAM_MAX_CHUNK) chunk_size_ *= 2;
+    return true;
+}
+
+bool input_stream_t::read_byte(char *out) {
+    if (pos_ == buffer_.size() && !fill()) return false;
+    *out = buffer_[pos_++];
+    return true;
+}
+
+bool input_stream_t::read_until(char delim, std::string *out) {
+    out->clear();
+    bool read_anything = false;
+    for (;;) {
+        if (pos_ == buffer_.size() && !fill()) return read_anything;
+        read_anything = true;
+
+        std::vector<char>::const_iterator start = buffer_.begin() + pos_;
+        std::vector<char>::const_iterator found = std::find(start, buffer_.cend(), delim);
+        out->append(start, found);
+        if (found != buffer_.end()) {
+            pos_ = found - buffer_.begin() + 1;
+            return true;
+        }
+        pos_ = buffer_.size();
+    }
+}
+
+void input_stream_t::release() {
+    size_t unconsumed = buffer_.size() - pos_;
+    if (unconsumed > 0 && seekable_) {
+        if (lseek(fd_, -static_cast<off_t>(unconsumed), SEEK_CUR) == -1) {
+            wperror(L"lseek");
+        }
+    }
+    buffer_.clear();
+    pos_ = 0;
+}
+
 void io_close_t::print() const { fwprintf(stderr, L"close %d\n", fd); }
 
 void io_fd_t::print() const { fwprintf(stderr, L"FD map %d -> %d\n", old_fd, fd); }
@@ -32,6 +141,74 @@ void io_buffer_t::print() const {
              is_input ? "yes" : "no", (unsigned long)out_buffer_size());
 }
 
+void io_buffer_t::out_buffer_append(const char *ptr, size_t count) {
+    if (discarded) return;
+    total_size += count;
+    if (buffer_limit != 0 && total_size > buffer_limit) {
+        // Keep draining the pipe so the writer doesn't block, but don't hold on to anything.
+        discarded = true;
+        out_buffer = std::vector<char>();
+        decoded_lines = wcstring_list_t();
+        partial_line = std::string();
+        return;
+    }
+
+    if (decodes_lines) {
+        append_decoded_lines(ptr, count);
+    } else {
+        out_buffer.insert(out_buffer.end(), ptr, ptr + count);
+    }
+}
+
+void io_buffer_t::append_decoded_lines(const char *ptr, size_t count) {
+    const char *const end = ptr + count;
+    const char *last_newline = NULL;
+    for (const char *cursor = ptr; cursor < end;) {
+        const char *newline = (const char *)memchr(cursor, '\n', end - cursor);
+        if (newline == NULL) break;
+        last_newline = newline;
+        if (splits_lines) {
+            // Complete the pending line, if there is one, without copying the common case.
+            if (partial_line.empty()) {
+                decoded_lines.push_back(str2wcstring(cursor, newline - cursor));
+            } else {
+                partial_line.append(cursor, newline - cursor);
+                decoded_lines.push_back(str2wcstring(partial_line));
+                partial_line.clear();
+            }
+        }
+        cursor = newline + 1;
+    }
+
+    if (!splits_lines && last_newline != NULL) {
+        // Decode everything up to and including the last newline onto the single string.
+        if (decoded_lines.empty()) decoded_lines.push_back(wcstring());
+        partial_line.append(ptr, last_newline + 1 - ptr);
+        decoded_lines.back().append(str2wcstring(partial_line));
+        partial_line.clear();
+    }
+    partial_line.append(last_newline ? last_newline + 1 : ptr, end);
+}
+
+bool io_buffer_t::take_lines(wcstring_list_t *out_lines) {
+    assert(decodes_lines);
+    out_lines->clear();
+    if (discarded) return false;
+
+    if (splits_lines) {
+        if (!partial_line.empty()) decoded_lines.push_back(str2wcstring(partial_line));
+    } else {
+        if (decoded_lines.empty()) decoded_lines.push_back(wcstring());
+        decoded_lines.back().append(str2wcstring(partial_line));
+        // Trim off a trailing newline.
+        wcstring &str = decoded_lines.back();
+        if (!str.empty() && str.at(str.size() - 1) == L'\n') str.resize(str.size() - 1);
+    }
+    partial_line.clear();
+    out_lines->swap(decoded_lines);
+    return true;
+}
+
 void io_buffer_t::read() {
     exec_close(pipe_fd[1]);
 
@@ -100,6 +277,16 @@ shared_ptr<io_buffer_t> io_buffer_t::create(int fd, const io_chain_t &conflicts)
     return buffer_redirect;
 }
 
+shared_ptr<io_buffer_t> io_buffer_t::create_for_cmdsubst(bool split_lines, size_t buffer_limit) {
+    shared_ptr<io_buffer_t> buffer = create(STDOUT_FILENO, io_chain_t());
+    if (buffer) {
+        buffer->decodes_lines = true;
+        buffer->splits_lines = split_lines;
+        buffer->buffer_limit = buffer_limit;
+    }
+    return buffer;
+}
+
 io_buffer_t::~io_buffer_t() {
     if (pipe_fd[0] >= 0) {
         exec_close(pipe_fd[0]);
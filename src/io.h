@@ -4,6 +4,8 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <functional>
+#include <string>
 #include <vector>
 // Note that we have to include something to get any _LIBCPP_VERSION defined so we can detect libc++
 // So it's key that vector go above. If we didn't need vector for other reasons, we might include
@@ -98,10 +100,35 @@ class io_pipe_t : public io_data_t {
 class io_chain_t;
 class io_buffer_t : public io_pipe_t {
    private:
-    /// Buffer to save output in.
+    /// Buffer to save output in, unless it's decoded into lines as it arrives.
     std::vector<char> out_buffer;
 
-    explicit io_buffer_t(int f) : io_pipe_t(IO_BUFFER, f, false /* not input */), out_buffer() {}
+    /// Whether the output is decoded into lines as it arrives, as for a command substitution.
+    bool decodes_lines;
+    /// Whether each line is kept as a separate string, or all the output as one.
+    bool splits_lines;
+    /// The decoded output, if decodes_lines is set.
+    wcstring_list_t decoded_lines;
+    /// The output after the last newline. It's decoded once its line is complete, so we never split
+    /// a multibyte character.
+    std::string partial_line;
+    /// The most bytes of output to accept, or 0 for no limit.
+    size_t buffer_limit;
+    /// The number of bytes of output so far.
+    size_t total_size;
+    /// Set when the output has exceeded buffer_limit and has been thrown away.
+    bool discarded;
+
+    explicit io_buffer_t(int f)
+        : io_pipe_t(IO_BUFFER, f, false /* not input */),
+          out_buffer(),
+          decodes_lines(false),
+          splits_lines(false),
+          buffer_limit(0),
+          total_size(0),
+          discarded(false) {}
+
+    void append_decoded_lines(const char *ptr, size_t count);
 
    public:
     virtual void print() const;
@@ -109,9 +136,7 @@ class io_buffer_t : public io_pipe_t {
     virtual ~io_buffer_t();
 
     /// Function to append to the buffer.
-    void out_buffer_append(const char *ptr, size_t count) {
-        out_buffer.insert(out_buffer.end(), ptr, ptr + count);
-    }
+    void out_buffer_append(const char *ptr, size_t count);
 
     /// Function to get a pointer to the buffer.
     char *out_buffer_ptr(void) { return out_buffer.empty() ? NULL : &out_buffer.at(0); }
@@ -134,6 +159,16 @@ class io_buffer_t : public io_pipe_t {
     /// \param conflicts A set of IO redirections. The function ensures that any pipe it makes does
     /// not conflict with an fd redirection in this list.
     static shared_ptr<io_buffer_t> create(int fd, const io_chain_t &conflicts);
+
+    /// Create a buffer for the output of a command substitution, which decodes the output as it
+    /// arrives. If split_lines is set, each line becomes a separate string; otherwise all of the
+    /// output becomes one string, minus a trailing newline. If buffer_limit is not 0 and more than
+    /// that many bytes arrive, all of the output is discarded.
+    static shared_ptr<io_buffer_t> create_for_cmdsubst(bool split_lines, size_t buffer_limit);
+
+    /// Decodes the rest of the output of a command substitution buffer after read(), and moves the
+    /// result to out_lines. Returns false if the output was discarded.
+    bool take_lines(wcstring_list_t *out_lines);
 };
 
 class io_chain_t : public std::vector<shared_ptr<io_data_t> > {
@@ -168,36 +203,123 @@ class output_stream_t {
     void operator=(const output_stream_t &s);
 
     wcstring buffer_;
+    // If not -1, the fd that output is written to as it accumulates.
+    int stream_fd_;
+    // If set, stream_fd_ is non-blocking, and this is called whenever it is full. See
+    // stream_to_fd().
+    std::function<bool(int)> stream_wait_;
+    // Set once a write to stream_fd_ has failed, after which output is discarded.
+    bool write_failed_;
+
+    // How much output to accumulate before writing it to stream_fd_.
+    static const size_t stream_chunk_size = 4096;
+
+    void flush_if_full() {
+        if (stream_fd_ >= 0 && buffer_.size() >= stream_chunk_size) flush();
+    }
 
    public:
-    output_stream_t() {}
+    output_stream_t() : stream_fd_(-1), write_failed_(false) {}
 
-    void append(const wcstring &s) { this->buffer_.append(s); }
+    void append(const wcstring &s) {
+        this->buffer_.append(s);
+        flush_if_full();
+    }
 
-    void append(const wchar_t *s) { this->buffer_.append(s); }
+    void append(const wchar_t *s) {
+        this->buffer_.append(s);
+        flush_if_full();
+    }
 
-    void append(wchar_t s) { this->buffer_.push_back(s); }
+    void append(wchar_t s) {
+        this->buffer_.push_back(s);
+        flush_if_full();
+    }
 
-    void append(const wchar_t *s, size_t amt) { this->buffer_.append(s, amt); }
+    void append(const wchar_t *s, size_t amt) {
+        this->buffer_.append(s, amt);
+        flush_if_full();
+    }
 
-    void push_back(wchar_t c) { this->buffer_.push_back(c); }
+    void push_back(wchar_t c) {
+        this->buffer_.push_back(c);
+        flush_if_full();
+    }
 
     void append_format(const wchar_t *format, ...) {
         va_list va;
         va_start(va, format);
         ::append_formatv(this->buffer_, format, va);
         va_end(va);
+        flush_if_full();
     }
 
     void append_formatv(const wchar_t *format, va_list va_orig) {
         ::append_formatv(this->buffer_, format, va_orig);
+        flush_if_full();
+    }
+
+    /// Write output to fd in chunks as it is produced, instead of buffering all of it until the
+    /// builtin finishes. The fd is not owned. If \p wait is given, the fd must be non-blocking, and
+    /// wait is called with it whenever it is full. It returns whether the fd can be written to
+    /// again. Once it returns false, streaming stops, and the output that was not written is kept
+    /// in the buffer along with any that follows.
+    void stream_to_fd(int fd, const std::function<bool(int)> &wait = std::function<bool(int)>()) {
+        stream_fd_ = fd;
+        stream_wait_ = wait;
     }
 
+    /// Write any buffered output to the fd given to stream_to_fd().
+    void flush();
+
+    /// Returns whether output could not be written, e.g. because the reading end of a pipe was
+    /// closed. Builtins producing output in a loop should then stop, like a process would on
+    /// SIGPIPE.
+    bool write_failed() const { return write_failed_; }
+
     const wcstring &buffer() const { return this->buffer_; }
 
     bool empty() const { return buffer_.empty(); }
 };
 
+/// Class representing the input that a builtin reads from its stdin. Input is read ahead in chunks
+/// only when that cannot take input away from later commands: when the fd is read by this builtin
+/// alone, or when it is seekable, in which case release() seeks back over what was not consumed.
+/// Otherwise the fd is read one byte at a time.
+class input_stream_t {
+   private:
+    // No copying.
+    input_stream_t(const input_stream_t &s);
+    void operator=(const input_stream_t &s);
+
+    const int fd_;
+    bool seekable_;
+    bool can_read_ahead_;
+    bool eof_;
+    // Bytes that have been read from the fd; those before pos_ have been consumed.
+    std::vector<char> buffer_;
+    size_t pos_;
+    // How much to read at once. This grows as the builtin keeps consuming input.
+    size_t chunk_size_;
+
+    bool fill();
+
+   public:
+    /// Construct a stream reading from fd. exclusive indicates that nothing else reads from fd.
+    input_stream_t(int fd, bool exclusive);
+    ~input_stream_t() { release(); }
+
+    /// Read a single byte. Returns false at EOF or on error.
+    bool read_byte(char *out);
+
+    /// Read bytes up to the delimiter, which is consumed but not stored. Returns false if EOF or an
+    /// error was hit before reading anything.
+    bool read_until(char delim, std::string *out);
+
+    /// Give back any bytes that were read ahead but not consumed, if the fd is seekable.
+    void release();
+};
+
 struct io_streams_t {
     output_stream_t out;
     output_stream_t err;
@@ -210,6 +332,10 @@ struct io_streams_t {
     // < foo.txt
     bool stdin_is_directly_redirected;
 
+    // Whether stdin_fd is read by nothing but this builtin, e.g. the pipe from the previous process
+    // in the job, so that reading ahead of what the builtin consumes loses nothing.
+    bool stdin_is_exclusive;
+
     // Indicates whether stdout and stderr are redirected (e.g. to a file or piped).
     bool out_is_redirected;
     bool err_is_redirected;
@@ -220,9 +346,24 @@ struct io_streams_t {
     io_streams_t()
         : stdin_fd(-1),
           stdin_is_directly_redirected(false),
+          stdin_is_exclusive(false),
           out_is_redirected(false),
           err_is_redirected(false),
           io_chain(NULL) {}
+
+    /// Returns the buffered reader for stdin_fd, creating it on first use.
+    input_stream_t &stdin_stream() {
+        if (!stdin_stream_) stdin_stream_.reset(new input_stream_t(stdin_fd, stdin_is_exclusive));
+        return *stdin_stream_;
+    }
+
+    /// Give back stdin input that was read ahead but not consumed. Called when the builtin is done.
+    void release_stdin() {
+        if (stdin_stream_) stdin_stream_->release();
+    }
+
+   private:
+    std::unique_ptr<input_stream_t> stdin_stream_;
 };
 
 #if 0
@@ -83,13 +83,32 @@ static std::queue<main_thread_request_t *> s_main_thread_request_queue;
 // Notifying pipes.
 static int s_read_pipe, s_write_pipe;
 
+// Set in a forked child, which has none of its parent's threads. See iothread_init.
+static bool s_forked_child = false;
+
+static void iothread_note_forked_child(void) { s_forked_child = true; }
+
 static void iothread_init(void) {
     static bool inited = false;
-    if (!inited) {
-        inited = true;
-
-        // Initialize some locks.
-        VOMIT_ON_FAILURE(pthread_cond_init(&s_main_thread_performer_cond, NULL));
+    if (!inited || s_forked_child) {
+        if (!inited) {
+            inited = true;
+
+            // Initialize some locks.
+            VOMIT_ON_FAILURE(pthread_cond_init(&s_main_thread_performer_cond, NULL));
+            VOMIT_ON_FAILURE(pthread_atfork(NULL, NULL, iothread_note_forked_child));
+        } else {
+            // We are a forked child that has become a main thread of its own (the test suite does
+            // this). None of the parent's threads exist here, and sharing its completion pipe
+            // would let the processes steal each other's wakeups, so start over.
+            s_forked_child = false;
+            close(s_read_pipe);
+            close(s_write_pipe);
+            auto locker = s_spawn_requests.acquire();
+            locker.value.request_queue = std::queue<spawn_request_t>();
+            locker.value.thread_count = 0;
+            s_result_queue.acquire().value = std::queue<spawn_request_t>();
+        }
 
         // Initialize the completion pipes.
         int pipes[2] = {0, 0};
@@ -177,7 +196,9 @@ static void iothread_spawn() {
 }
 
 int iothread_perform_impl(void_function_t &&func, void_function_t &&completion) {
-    ASSERT_IS_MAIN_THREAD();
+    // Completions run on the main thread, so only it can ask for one. Other threads may hand off
+    // work that doesn't need one.
+    if (completion != nullptr) ASSERT_IS_MAIN_THREAD();
     ASSERT_IS_NOT_FORKED_CHILD();
     iothread_init();
 
@@ -260,6 +281,10 @@ void iothread_drain_all(void) {
             iothread_service_completion();
         }
     }
+    // The last thread may have posted its completion just before exiting; run that too.
+    while (iothread_wait_for_pending_completions(0)) {
+        iothread_service_completion();
+    }
 #if TIME_DRAIN
     double after = timef();
     fwprintf(stdout, L"(Waited %.02f msec for %d thread(s) to drain)\n", 1000 * (after - now),
@@ -67,6 +67,7 @@ int iothread_perform(const HANDLER &handler, const COMPLETION &completion) {
 }
 
 // variant of iothread_perform without a completion handler
+// unlike the other variants, this may be called from a background thread
 inline int iothread_perform(std::function<void(void)> &&func) {
     return iothread_perform_impl(std::move(func), std::function<void(void)>());
 }
@@ -10,7 +10,8 @@
 
 // Least-recently-used cache class.
 //
-// This a map from wcstring to CONTENTS, that will evict entries when the count exceeds the maximum.
+// This a map from KEY (by default wcstring) to CONTENTS, that will evict entries when the count
+// exceeds the maximum.
 // It uses CRTP to inform clients when entries are evicted. This uses the classic LRU cache
 // structure: a dictionary mapping keys to nodes, where the nodes also form a linked list. Our
 // linked list is circular and has a sentinel node (the "mouth" - picture a snake swallowing its
@@ -19,10 +20,10 @@
 // having a "back pointer": they store an iterator to the entry in the map containing the node. This
 // allows us, given a node, to immediately locate the node and its key in the dictionary. This
 // allows us to avoid duplicating the key in the node.
-template <class DERIVED, class CONTENTS>
+template <class DERIVED, class CONTENTS, class KEY = wcstring>
 class lru_cache_t {
     struct lru_node_t;
-    typedef typename std::map<wcstring, lru_node_t>::iterator node_iter_t;
+    typedef typename std::map<KEY, lru_node_t>::iterator node_iter_t;
 
     struct lru_link_t {
         // Our doubly linked list
@@ -54,7 +55,7 @@ class lru_cache_t {
     // All of our nodes
     // Note that our linked list contains pointers to these nodes in the map
     // We are dependent on the iterator-noninvalidation guarantees of std::map
-    std::map<wcstring, lru_node_t> node_map;
+    std::map<KEY, lru_node_t> node_map;
 
     // Head of the linked list
     // The list is circular!
@@ -88,7 +89,7 @@ class lru_cache_t {
         node->next->prev = node->prev;
 
         // Pull out our key and value
-        wcstring key = std::move(node->iter->first);
+        KEY key = std::move(node->iter->first);
         CONTENTS value(std::move(node->value));
 
         // Remove us from the map. This deallocates node!
@@ -108,7 +109,7 @@ class lru_cache_t {
 
     // CRTP callback for when a node is evicted.
     // Clients can implement this
-    void entry_was_evicted(wcstring key, CONTENTS value) {
+    void entry_was_evicted(KEY key, CONTENTS value) {
         USE(key);
         USE(value);
     }
@@ -184,7 +185,7 @@ class lru_cache_t {
 
     // Returns the value for a given key, or NULL.
     // This counts as a "use" and so promotes the node
-    CONTENTS *get(const wcstring &key) {
+    CONTENTS *get(const KEY &key) {
         auto where = this->node_map.find(key);
         if (where == this->node_map.end()) {
             // not found
@@ -195,7 +196,7 @@ class lru_cache_t {
     }
 
     // Evicts the node for a given key, returning true if a node was evicted.
-    bool evict_node(const wcstring &key) {
+    bool evict_node(const KEY &key) {
         auto where = this->node_map.find(key);
         if (where == this->node_map.end()) return false;
         evict_node(&where->second);
@@ -204,7 +205,7 @@ class lru_cache_t {
 
     // Adds a node under the given key. Returns true if the node was added, false if the node was
     // not because a node with that key is already in the set.
-    bool insert(wcstring key, CONTENTS value) {
+    bool insert(KEY key, CONTENTS value) {
         if (!this->insert_no_eviction(std::move(key), std::move(value))) {
             return false;
         }
@@ -217,7 +218,7 @@ class lru_cache_t {
 
     // Adds a node under the given key without triggering eviction. Returns true if the node was
     // added, false if the node was not because a node with that key is already in the set.
-    bool insert_no_eviction(wcstring key, CONTENTS value) {
+    bool insert_no_eviction(KEY key, CONTENTS value) {
         // Try inserting; return false if it was already in the set.
         auto iter_inserted = this->node_map.emplace(std::move(key), lru_node_t(std::move(value)));
         if (!iter_inserted.second) {
@@ -278,7 +279,7 @@ class lru_cache_t {
         const lru_link_t *node;
 
        public:
-        typedef std::pair<const wcstring &, const CONTENTS &> value_type;
+        typedef std::pair<const KEY &, const CONTENTS &> value_type;
 
         explicit iterator(const lru_link_t *val) : node(val) {}
         void operator++() { node = node->prev; }
@@ -286,7 +287,7 @@ class lru_cache_t {
         bool operator!=(const iterator &other) { return !(*this == other); }
         value_type operator*() const {
             const lru_node_t *dnode = static_cast<const lru_node_t *>(node);
-            const wcstring &key = dnode->iter->first;
+            const KEY &key = dnode->iter->first;
             return {key, dnode->value};
         }
     };
@@ -75,9 +75,10 @@ static wcstring profiling_cmd_name_for_redirectable_block(const parse_node_t &no
     return result;
 }
 
-parse_execution_context_t::parse_execution_context_t(parse_node_tree_t t, const wcstring &s,
+parse_execution_context_t::parse_execution_context_t(parsed_tree_ref_t t, const wcstring &s,
                                                      parser_t *p, int initial_eval_level)
-    : tree(std::move(t)),
+    : tree_ref(std::move(t)),
+      tree(*tree_ref),
       src(s),
       parser(p),
       eval_level(initial_eval_level),
@@ -910,13 +911,19 @@ parse_execution_result_t parse_execution_context_t::determine_arguments(
     const parse_node_tree_t::parse_node_list_t argument_nodes =
         tree.find_nodes(parent, symbol_argument);
     out_arguments->reserve(out_arguments->size() + argument_nodes.size());
+
+    // Expect all arguments to have source.
+    wcstring_list_t arg_strs;
+    for (size_t i = 0; i < argument_nodes.size(); i++) {
+        assert(argument_nodes.at(i)->has_source());
+        arg_strs.push_back(argument_nodes.at(i)->get_source(src));
+    }
+    expand_prefetch_cmdsubsts(arg_strs);
+
     std::vector<completion_t> arg_expanded;
     for (size_t i = 0; i < argument_nodes.size(); i++) {
         const parse_node_t &arg_node = *argument_nodes.at(i);
-
-        // Expect all arguments to have source.
-        assert(arg_node.has_source());
-        const wcstring arg_str = arg_node.get_source(src);
+        const wcstring &arg_str = arg_strs.at(i);
 
         // Expand this string.
         parse_error_list_t errors;
@@ -925,12 +932,14 @@ parse_execution_result_t parse_execution_context_t::determine_arguments(
         parse_error_offset_source_start(&errors, arg_node.source_start);
         switch (expand_ret) {
             case EXPAND_ERROR: {
+                expand_forget_prefetched_cmdsubsts();
                 this->report_errors(errors);
                 return parse_execution_errored;
             }
             case EXPAND_WILDCARD_NO_MATCH: {
                 if (glob_behavior == failglob) {
                     // Report the unmatched wildcard error and stop processing.
+                    expand_forget_prefetched_cmdsubsts();
                     report_unmatched_wildcard_error(arg_node);
                     return parse_execution_errored;
                 }
@@ -954,6 +963,7 @@ parse_execution_result_t parse_execution_context_t::determine_arguments(
         }
     }
 
+    expand_forget_prefetched_cmdsubsts();
     return parse_execution_success;
 }
 
@@ -28,7 +28,9 @@ enum parse_execution_result_t {
 
 class parse_execution_context_t {
    private:
-    const parse_node_tree_t tree;
+    // The tree we execute. This may be shared with other contexts, so it must not be modified.
+    const parsed_tree_ref_t tree_ref;
+    const parse_node_tree_t &tree;
     const wcstring src;
     io_chain_t block_io;
     parser_t *const parser;
@@ -127,7 +129,7 @@ class parse_execution_context_t {
     int line_offset_of_character_at_offset(size_t char_idx);
 
    public:
-    parse_execution_context_t(parse_node_tree_t t, const wcstring &s, parser_t *p,
+    parse_execution_context_t(parsed_tree_ref_t t, const wcstring &s, parser_t *p,
                               int initial_eval_level);
 
     /// Returns the current eval level.
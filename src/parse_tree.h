@@ -226,6 +226,10 @@ class parse_node_tree_t : public std::vector<parse_node_t> {
     bool job_should_be_backgrounded(const parse_node_t &job) const;
 };
 
+/// A reference to an immutable parse tree, which may be shared between several executions (e.g. a
+/// function body that is parsed once and then run on every call).
+typedef std::shared_ptr<const parse_node_tree_t> parsed_tree_ref_t;
+
 /// The big entry point. Parse a string, attempting to produce a tree for the given goal type.
 bool parse_tree_from_string(const wcstring &str, parse_tree_flags_t flags,
                             parse_node_tree_t *output, parse_error_list_t *errors,
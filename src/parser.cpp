@@ -598,10 +598,20 @@ int parser_t::eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t
 
 int parser_t::eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t block_type,
                    parse_node_tree_t tree) {
+    if (tree.empty()) {
+        return 0;
+    }
+    return this->eval(cmd, io, block_type,
+                      std::make_shared<const parse_node_tree_t>(std::move(tree)));
+}
+
+int parser_t::eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t block_type,
+                   const parsed_tree_ref_t &tree) {
     CHECK_BLOCK(1);
     assert(block_type == TOP || block_type == SUBST);
+    assert(tree);
 
-    if (tree.empty()) {
+    if (tree->empty()) {
         return 0;
     }
 
@@ -614,7 +624,7 @@ int parser_t::eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t
 
     // Append to the execution context stack.
     execution_contexts.push_back(
-        make_unique<parse_execution_context_t>(std::move(tree), cmd, this, exec_eval_level));
+        make_unique<parse_execution_context_t>(tree, cmd, this, exec_eval_level));
     const parse_execution_context_t *ctx = execution_contexts.back().get();
 
     // Execute the first node.
@@ -247,6 +247,12 @@ class parser_t {
     int eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t block_type,
              parse_node_tree_t t);
 
+    /// Evaluate the expressions contained in cmd, using a shared parse tree that has already been
+    /// built from it. This avoids re-parsing source that is executed repeatedly, like function
+    /// bodies.
+    int eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t block_type,
+             const parsed_tree_ref_t &tree);
+
     /// Evaluates a block node at the given node offset in the topmost execution context.
     int eval_block_node(node_offset_t node_idx, const io_chain_t &io, enum block_type_t block_type);
 
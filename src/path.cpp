@@ -5,12 +5,16 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 #include <wchar.h>
 
+#include <algorithm>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -18,6 +22,8 @@
 #include "env.h"
 #include "expand.h"
 #include "fallback.h"  // IWYU pragma: keep
+#include "iothread.h"
+#include "lru.h"
 #include "path.h"
 #include "wutil.h"  // IWYU pragma: keep
 
@@ -385,6 +391,152 @@ bool path_is_valid(const wcstring &path, const wcstring &working_directory) {
     return path_is_valid;
 }
 
+/// How long the status of a path is remembered before it's checked again, in milliseconds.
+#define PATH_STATUS_CACHE_TTL_MSEC 2000
+
+/// How long a check without a timeout waits for another thread to check a path, before it checks
+/// the path itself.
+#define PATH_STATUS_TAKE_OVER_MSEC 50
+
+/// How many path statuses are remembered.
+#define PATH_STATUS_CACHE_SIZE 1024
+
+namespace {
+struct cached_path_status_t {
+    path_status_t status;
+    // When the path was checked, as returned by timef().
+    double when;
+};
+
+class path_status_cache_t : public lru_cache_t<path_status_cache_t, cached_path_status_t> {
+    typedef lru_cache_t<path_status_cache_t, cached_path_status_t> super;
+
+   public:
+    using super::super;
+};
+
+/// The path status cache, and the paths that are being checked. Anyone waiting for a check to
+/// finish waits on the condition, which is broadcast after each check.
+struct path_status_state_t {
+    mutex_lock_t lock;
+    pthread_cond_t cond;
+    path_status_cache_t cache;
+    std::set<wcstring> paths_being_checked;
+    // Statuses from checks that started before this time are out of date.
+    double invalidated_at;
+
+    path_status_state_t() : cache(PATH_STATUS_CACHE_SIZE), invalidated_at(0) {
+        VOMIT_ON_FAILURE(pthread_cond_init(&cond, NULL));
+    }
+};
+}  // namespace
+
+/// Checks run on detached background threads, which may still be going at exit, so the state is
+/// never destroyed.
+static path_status_state_t &path_status_state() {
+    static path_status_state_t *const state = new path_status_state_t();
+    return *state;
+}
+
+/// Stats the path and records its status in the cache.
+static void check_path_status(const wcstring &path) {
+    struct stat buf;
+    cached_path_status_t result;
+    // Take the time first, so a check that straddles an invalidation is out of date.
+    result.when = timef();
+    if (wstat(path, &buf) != 0) {
+        result.status = PATH_STATUS_MISSING;
+    } else {
+        result.status = S_ISDIR(buf.st_mode) ? PATH_STATUS_DIRECTORY : PATH_STATUS_OTHER;
+    }
+
+    path_status_state_t &state = path_status_state();
+    scoped_lock locker(state.lock);
+    state.cache.evict_node(path);
+    state.cache.insert(path, result);
+    state.paths_being_checked.erase(path);
+    VOMIT_ON_FAILURE(pthread_cond_broadcast(&state.cond));
+}
+
+std::vector<path_status_t> path_get_statuses(const wcstring_list_t &abs_paths, long timeout_msec,
+                                             bool stop_at_missing) {
+    ASSERT_IS_BACKGROUND_THREAD();
+    path_status_state_t &state = path_status_state();
+    std::vector<path_status_t> result(abs_paths.size(), PATH_STATUS_UNKNOWN);
+    const double deadline = timef() + timeout_msec / 1000.0;
+    // Without a timeout we check paths ourselves, since we are usually on an iothread already:
+    // handing checks to the pool and waiting for them deadlocks once all its threads are waiting.
+    // For the same reason we only wait so long for a check another thread started.
+    bool take_over_checks = false;
+
+    for (;;) {
+        // Take what the cache knows, and start checking the paths that nobody is checking yet.
+        wcstring_list_t paths_to_check;
+        {
+            scoped_lock locker(state.lock);
+            const double oldest_fresh = std::max(
+                timef() - PATH_STATUS_CACHE_TTL_MSEC / 1000.0, state.invalidated_at);
+            size_t unknown_count = 0;
+            bool found_missing = false;
+            for (size_t i = 0; i < abs_paths.size(); i++) {
+                if (result.at(i) != PATH_STATUS_UNKNOWN) continue;
+                const wcstring &path = abs_paths.at(i);
+                const cached_path_status_t *cached = state.cache.get(path);
+                if (cached != NULL && cached->when >= oldest_fresh) {
+                    result.at(i) = cached->status;
+                    found_missing = found_missing || cached->status == PATH_STATUS_MISSING;
+                } else {
+                    unknown_count++;
+                    if (state.paths_being_checked.insert(path).second || take_over_checks) {
+                        paths_to_check.push_back(path);
+                    }
+                }
+            }
+            if (unknown_count == 0 || (stop_at_missing && found_missing)) break;
+
+            if (paths_to_check.empty()) {
+                // Everything left is being checked already; wait for one of the checks to finish.
+                double now = timef();
+                double wait_until = deadline;
+                if (timeout_msec < 0) {
+                    wait_until = now + PATH_STATUS_TAKE_OVER_MSEC / 1000.0;
+                } else if (now >= deadline) {
+                    break;
+                }
+                struct timespec until;
+                until.tv_sec = (time_t)wait_until;
+                until.tv_nsec = (long)((wait_until - until.tv_sec) * 1e9);
+                int ret = pthread_cond_timedwait(&state.cond, &state.lock.mutex, &until);
+                if (ret == ETIMEDOUT) {
+                    take_over_checks = timeout_msec < 0;
+                } else {
+                    VOMIT_ON_FAILURE(ret);
+                }
+                continue;
+            }
+        }
+
+        if (timeout_msec < 0) {
+            for (const wcstring &path : paths_to_check) check_path_status(path);
+        } else {
+            for (const wcstring &path : paths_to_check) {
+                iothread_perform([path]() { check_path_status(path); });
+            }
+        }
+    }
+    return result;
+}
+
+path_status_t path_get_status(const wcstring &abs_path) {
+    return path_get_statuses(wcstring_list_t(1, abs_path)).front();
+}
+
+void path_invalidate_statuses() {
+    path_status_state_t &state = path_status_state();
+    scoped_lock locker(state.lock);
+    state.invalidated_at = timef();
+}
+
 bool paths_are_same_file(const wcstring &path1, const wcstring &path2) {
     if (paths_are_equivalent(path1, path2)) return true;
 
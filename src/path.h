@@ -75,6 +75,33 @@ bool paths_are_equivalent(const wcstring &p1, const wcstring &p2);
 
 bool path_is_valid(const wcstring &path, const wcstring &working_directory);
 
+/// What a stat() of a path found.
+enum path_status_t {
+    PATH_STATUS_UNKNOWN,  // the check didn't finish in time
+    PATH_STATUS_MISSING,
+    PATH_STATUS_DIRECTORY,
+    PATH_STATUS_OTHER
+};
+
+/// Returns the status of each of the absolute paths. Statuses are cached for a couple of seconds
+/// and shared between threads, so validating autosuggestions and highlighting don't stat the same
+/// paths on every keystroke. This does I/O, so it must not be called on the main thread.
+///
+/// If timeout_msec is negative, the paths that aren't cached are checked on the calling thread.
+/// Otherwise they are checked in parallel on background threads, this returns after at most
+/// timeout_msec, and the paths whose
+/// checks haven't finished are PATH_STATUS_UNKNOWN. Those checks go on in the background and cache
+/// their results when they finish. If stop_at_missing is set, this returns as soon as any path is
+/// known to be missing, and the paths that weren't checked by then may also be PATH_STATUS_UNKNOWN.
+std::vector<path_status_t> path_get_statuses(const wcstring_list_t &abs_paths,
+                                             long timeout_msec = -1, bool stop_at_missing = false);
+
+/// Returns the status of a single absolute path, as path_get_statuses does.
+path_status_t path_get_status(const wcstring &abs_path);
+
+/// Forgets the cached path statuses, e.g. after running a command that may have changed the files.
+void path_invalidate_statuses();
+
 /// Returns whether the two paths refer to the same file.
 bool paths_are_same_file(const wcstring &path1, const wcstring &path2);
 
@@ -59,25 +59,20 @@ static void debug_safe_int(int level, const char *format, int val) {
     debug_safe(level, format, buff);
 }
 
-/// This function should be called by both the parent process and the child right after fork() has
-/// been called. If job control is enabled, the child is put in the jobs group, and if the child is
-/// also in the foreground, it is also given control of the terminal. When called in the parent
-/// process, this function may fail, since the child might have already finished and called exit.
-/// The parent process may safely ignore the exit status of this call.
+/// Puts the process \p pid of job \p j into the process group \p pgid if job control is enabled,
+/// and gives that group the terminal if the job is in the foreground. This only reads the job and
+/// the process, so it may be called in the child of vfork.
 ///
 /// Returns true on sucess, false on failiure.
-bool set_child_group(job_t *j, process_t *p, int print_errors) {
+static bool set_process_group(const job_t *j, const process_t *p, pid_t pid, pid_t pgid,
+                              int print_errors) {
     bool retval = true;
 
     if (j->get_flag(JOB_CONTROL)) {
-        if (!j->pgid) {
-            j->pgid = p->pid;
-        }
-
-        if (setpgid(p->pid, j->pgid)) {  //!OCLINT(collapsible if statements)
+        if (setpgid(pid, pgid)) {  //!OCLINT(collapsible if statements)
             // TODO: Figure out why we're testing whether the pgid is correct after attempting to
             // set it failed. This was added in commit 4e912ef8 from 2012-02-27.
-            if (getpgid(p->pid) != j->pgid && print_errors) {
+            if (getpgid(pid) != pgid && print_errors) {
                 char pid_buff[128];
                 char job_id_buff[128];
                 char getpgid_buff[128];
@@ -85,10 +80,10 @@ bool set_child_group(job_t *j, process_t *p, int print_errors) {
                 char argv0[64];
                 char command[64];
 
-                format_long_safe(pid_buff, p->pid);
+                format_long_safe(pid_buff, pid);
                 format_long_safe(job_id_buff, j->job_id);
-                format_long_safe(getpgid_buff, getpgid(p->pid));
-                format_long_safe(job_pgid_buff, j->pgid);
+                format_long_safe(getpgid_buff, getpgid(pid));
+                format_long_safe(job_pgid_buff, pgid);
                 narrow_string_safe(argv0, p->argv0());
                 narrow_string_safe(command, j->command_wcstr());
 
@@ -100,15 +95,13 @@ bool set_child_group(job_t *j, process_t *p, int print_errors) {
                 retval = false;
             }
         }
-    } else {
-        j->pgid = getpid();
     }
 
     if (j->get_flag(JOB_TERMINAL) && j->get_flag(JOB_FOREGROUND)) {  //!OCLINT(early exit)
         int result = -1;
         errno = EINTR;
         while (result == -1 && errno == EINTR) {
-            result = tcsetpgrp(STDIN_FILENO, j->pgid);
+            result = tcsetpgrp(STDIN_FILENO, pgid);
         }
         if (result == -1) {
             if (errno == ENOTTY) redirect_tty_output();
@@ -128,6 +121,24 @@ bool set_child_group(job_t *j, process_t *p, int print_errors) {
     return retval;
 }
 
+/// This function should be called by both the parent process and the child right after fork() has
+/// been called. If job control is enabled, the child is put in the jobs group, and if the child is
+/// also in the foreground, it is also given control of the terminal. When called in the parent
+/// process, this function may fail, since the child might have already finished and called exit.
+/// The parent process may safely ignore the exit status of this call.
+///
+/// Returns true on sucess, false on failiure.
+bool set_child_group(job_t *j, process_t *p, int print_errors) {
+    if (j->get_flag(JOB_CONTROL)) {
+        if (!j->pgid) {
+            j->pgid = p->pid;
+        }
+    } else {
+        j->pgid = getpid();
+    }
+    return set_process_group(j, p, p->pid, j->pgid, print_errors);
+}
+
 /// Set up a childs io redirections. Should only be called by setup_child_process(). Does the
 /// following: First it closes any open file descriptors not related to the child by calling
 /// close_unused_internal_pipes() and closing the universal variable server file descriptor. It then
@@ -253,6 +264,25 @@ int setup_child_process(job_t *j, process_t *p, const io_chain_t &io_chain) {
     return ok ? 0 : -1;
 }
 
+#if FISH_USE_VFORK
+void setup_vforked_child(const job_t *j, const process_t *p, const io_chain_t &io_chain) {
+    // This is what setup_child_process does, except that the pid and pgid are not stored, and the
+    // signal block count is left alone.
+    pid_t pid = getpid();
+    pid_t pgid = j->get_flag(JOB_CONTROL) && j->pgid ? j->pgid : pid;
+    if (set_process_group(j, p, pid, pgid, 1)) {
+        if (handle_child_io(io_chain) != 0) {
+            exit_without_destructors(1);
+        }
+        signal_reset_handlers();
+    }
+
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigprocmask(SIG_SETMASK, &sigs, NULL);
+}
+#endif
+
 int g_fork_count = 0;
 
 /// This function is a wrapper around fork. If the fork calls fails with EAGAIN, it is retried
@@ -499,27 +529,3 @@ void safe_report_exec_error(int err, const char *actual_cmd, const char *const *
         }
     }
 }
-
-/// Perform output from builtins. May be called from a forked child, so don't do anything that may
-/// allocate memory, etc.
-bool do_builtin_io(const char *out, size_t outlen, const char *err, size_t errlen) {
-    int saved_errno = 0;
-    bool success = true;
-    if (out && outlen && write_loop(STDOUT_FILENO, out, outlen) < 0) {
-        saved_errno = errno;
-        if (errno != EPIPE) {
-            debug_safe(0, "Error while writing to stdout");
-            errno = saved_errno;
-            safe_perror("write_loop");
-        }
-        success = false;
-    }
-
-    if (err && errlen && write_loop(STDERR_FILENO, err, errlen) < 0) {
-        saved_errno = errno;
-        success = false;
-    }
-
-    errno = saved_errno;
-    return success;
-}
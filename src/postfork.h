@@ -12,6 +12,13 @@
 #ifndef FISH_USE_POSIX_SPAWN
 #define FISH_USE_POSIX_SPAWN HAVE_SPAWN_H
 #endif
+#ifndef FISH_USE_VFORK
+#ifdef __linux__
+#define FISH_USE_VFORK 1
+#else
+#define FISH_USE_VFORK 0
+#endif
+#endif
 
 class io_chain_t;
 class job_t;
@@ -33,15 +40,19 @@ bool set_child_group(job_t *j, process_t *p, int print_errors);
 /// On failiure, signal handlers, io redirections and process group of the process is undefined.
 int setup_child_process(job_t *j, process_t *p, const io_chain_t &io_chain);
 
+#if FISH_USE_VFORK
+/// Like setup_child_process, for the child of vfork. That child shares the memory of fish until it
+/// execs, so this only reads the job and the process, and doesn't touch the signal block count.
+/// Exits if a redirection fails. When this function returns, signals are unblocked.
+void setup_vforked_child(const job_t *j, const process_t *p, const io_chain_t &io_chain);
+#endif
+
 /// Call fork(), optionally waiting until we are no longer multithreaded. If the forked child
 /// doesn't do anything that could allocate memory, take a lock, etc. (like call exec), then it's
 /// not necessary to wait for threads to die. If the forked child may do those things, it should
 /// wait for threads to die.
 pid_t execute_fork(bool wait_for_threads_to_die);
 
-/// Perform output from builtins. Returns true on success.
-bool do_builtin_io(const char *out, size_t outlen, const char *err, size_t errlen);
-
 /// Report an error from failing to exec or posix_spawn a command.
 void safe_report_exec_error(int err, const char *actual_cmd, const char *const *argv,
                             const char *const *envv);
@@ -446,6 +446,16 @@ static int process_mark_finished_children(bool wants_await) {
     return processed_count;
 }
 
+void job_update_child_statuses() {
+    ASSERT_IS_MAIN_THREAD();
+    for (;;) {
+        int status = -1;
+        pid_t pid = waitpid(-1, &status, WUNTRACED | WNOHANG);
+        if (pid <= 0) break;
+        handle_child_status(pid, status);
+    }
+}
+
 /// This is called from a signal handler. The signal is always SIGCHLD.
 void job_handle_signal(int signal, siginfo_t *info, void *context) {
     UNUSED(signal);
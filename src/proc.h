@@ -32,6 +32,9 @@
 /// The status code use when illegal command name is encountered.
 #define STATUS_ILLEGAL_CMD 123
 
+/// The status code used when a command substitution produced more output than fish_read_limit.
+#define STATUS_READ_TOO_MUCH 122
+
 /// The status code used for normal exit in a  builtin.
 #define STATUS_BUILTIN_OK 0
 
@@ -338,6 +341,10 @@ int job_reap(bool interactive);
 /// Signal handler for SIGCHLD. Mark any processes with relevant information.
 void job_handle_signal(int signal, siginfo_t *info, void *con);
 
+/// Mark the processes of any children that have exited or stopped, without waiting for them. This
+/// does not rely on a SIGCHLD having been seen, so it also works while signals are blocked.
+void job_update_child_statuses();
+
 /// Send the specified signal to all processes in the specified job.
 int job_signal(job_t *j, int signal);
 
@@ -63,6 +63,7 @@
 #include "parse_tree.h"
 #include "parse_util.h"
 #include "parser.h"
+#include "path.h"
 #include "proc.h"
 #include "reader.h"
 #include "sanity.h"
@@ -1210,6 +1211,8 @@ static void update_autosuggestion(void) {
     if (data->allow_autosuggestion && !data->suppress_autosuggestion &&
         !data->command_line.empty() && data->history_search.is_at_end()) {
         const editable_line_t *el = data->active_edit_line();
+        // History suggestions are prefix searches, which the search index speeds up.
+        data->history->build_search_index_in_background();
         auto performer = get_autosuggestion_performer(el->text, el->position, data->history);
         iothread_perform(performer, &autosuggest_completed);
     }
@@ -1929,6 +1932,7 @@ void reader_run_command(parser_t &parser, const wcstring &cmd) {
 
     parser.eval(cmd, io_chain_t(), TOP);
     job_reap(1);
+    path_invalidate_statuses();
 
     gettimeofday(&time_after, NULL);
     set_env_cmd_duration(&time_after, &time_before);
@@ -2792,6 +2796,8 @@ const wchar_t *reader_readline(int nchars) {
 
                     const editable_line_t *el = &data->command_line;
                     data->search_buff.append(el->text);
+                    // Later searches can use the index; this one doesn't wait for it.
+                    data->history->build_search_index_in_background();
                     data->history_search = history_search_t(*data->history, data->search_buff,
                                                             HISTORY_SEARCH_TYPE_CONTAINS);
 
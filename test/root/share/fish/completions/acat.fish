@@ -0,0 +1,2 @@
+complete -c acat -w atool
+complete -c acat -a '(__fish_complete_atool_archive_contents)' -d 'Archive content'
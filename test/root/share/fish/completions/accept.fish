@@ -0,0 +1,3 @@
+__fish_complete_lpr accept
+complete -c accept -s r -d 'Accept reason' -x
+
@@ -0,0 +1 @@
+complete -c adiff -w atool
@@ -0,0 +1 @@
+complete -c apack -w atool
@@ -0,0 +1,13 @@
+#apt-cdrom
+complete -c apt-cdrom -s h -l help --description "Display help and exit"
+complete -r -c apt-cdrom -a add --description "Add new disc to source list"
+complete -x -c apt-cdrom -a ident --description "Report identity of disc"
+complete -r -c apt-cdrom -s d -l cdrom --description "Mount point"
+complete -f -c apt-cdrom -s r -l rename --description "Rename a disc"
+complete -f -c apt-cdrom -s m -l no-mount --description "No mounting"
+complete -f -c apt-cdrom -s f -l fast --description "Fast copy"
+complete -f -c apt-cdrom -s a -l thorough --description "Thorough package scan"
+complete -f -c apt-cdrom -s n -l no-act --description "No changes"
+complete -f -c apt-cdrom -s v -l version --description "Display version and exit"
+complete -r -c apt-cdrom -s c -l config-file --description "Specify config file"
+complete -x -c apt-cdrom -s o -l option --description "Specify options"
@@ -0,0 +1,7 @@
+
+#apt-extracttemplates
+complete -c apt-extracttemplates -s h -l help --description "Display help and exit"
+complete -r -c apt-extracttemplates -s t --description "Set temp dir"
+complete -r -c apt-extracttemplates -s c --description "Specifiy config file"
+complete -r -c apt-extracttemplates -s o --description "Specify options"
+
@@ -0,0 +1,6 @@
+#atd
+complete -f -c atd -s l --description "Limiting load factor"
+complete -f -c atd -s b --description "Minimum interval in seconds"
+complete -f -c atd -s d --description "Debug mode"
+complete -f -c atd -s s --description "Process at queue only once"
+
@@ -0,0 +1,2 @@
+
+complete -c break -s h -l help --description 'Display help and exit'
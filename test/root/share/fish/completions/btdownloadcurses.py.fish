@@ -0,0 +1 @@
+__fish_complete_bittorrent btdownloadcurses.py
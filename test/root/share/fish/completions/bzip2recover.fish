@@ -0,0 +1,11 @@
+complete -c bzip2recover -x -a "(
+	__fish_complete_suffix .tbz
+	__fish_complete_suffix .tbz2
+)
+"
+
+complete -c bzip2recover -x -a "(
+	__fish_complete_suffix .bz
+	__fish_complete_suffix .bz2
+)
+"
@@ -0,0 +1,2 @@
+complete -c colorsvn -w svn
+
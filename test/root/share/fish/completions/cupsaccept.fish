@@ -0,0 +1,3 @@
+__fish_complete_lpr cupsaccept
+complete -c cupsaccept -s r -d 'Accept reason' -x
+
@@ -0,0 +1,3 @@
+__fish_complete_lpr cupsreject
+complete -c cupsreject -s r -d 'Reject reason' -x
+
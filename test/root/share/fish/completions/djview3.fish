@@ -0,0 +1,3 @@
+
+complete -c djview3 -x -a "(__fish_complete_suffix .djvu)"
+
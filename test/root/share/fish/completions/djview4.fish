@@ -0,0 +1,3 @@
+
+complete -c djview4 -x -a "(__fish_complete_suffix .djvu)"
+
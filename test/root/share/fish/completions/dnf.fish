@@ -0,0 +1,5 @@
+#
+# Completions for the dnf command
+#
+
+complete -c dnf -w yum
@@ -0,0 +1 @@
+complete -c grep -w egrep
@@ -0,0 +1 @@
+complete -c tex -w etex
@@ -0,0 +1,2 @@
+
+complete -c exec -s h -l help --description 'Display help and exit'
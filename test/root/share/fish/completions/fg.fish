@@ -0,0 +1,2 @@
+complete -c fg -x -a "(__fish_complete_job_pids)"
+complete -c fg -s h -l help --description 'Display help and exit'
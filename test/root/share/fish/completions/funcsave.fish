@@ -0,0 +1 @@
+complete -c funcsave -xa "(functions -na)" --description "Save function"
@@ -0,0 +1,3 @@
+complete -c golint -l min_confidence -o min_confidence -d "Minimum confidence of a problem to print it" -x
+complete -c golint -l set_exit_status -o set_exit_status -d "Set exit status to 1 if any issues are found"
+complete -c golint -l help -o help -s h -d "Show help"
@@ -0,0 +1,2 @@
+complete -c gvim -w vim
+
@@ -0,0 +1,8 @@
+complete -c id -s g -l group --description "Print effective group id"
+complete -c id -s G -l groups --description "Print all group ids"
+complete -c id -s n -l name --description "Print name, not number"
+complete -c id -s r -l real --description "Print real ID, not effective"
+complete -c id -s u -l user --description "Print effective user ID"
+complete -c id -l help --description "Display help and exit"
+complete -c id -l version --description "Display version and exit"
+
@@ -0,0 +1 @@
+complete -c ll -w ls
@@ -0,0 +1,4 @@
+# native2ascii
+complete -c native2ascii -o reverse --description 'Perform the reverse operation'
+complete -c native2ascii -o encoding --description 'Specifies the name of the character encoding'
+complete -c native2ascii -o Joption --description 'Pass "option" to JVM'
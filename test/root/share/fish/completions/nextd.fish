@@ -0,0 +1 @@
+complete -c nextd -s l --description "Also print directory history"
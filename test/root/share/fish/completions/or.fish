@@ -0,0 +1,3 @@
+
+complete -c or -s h -l help --description 'Display help and exit'
+complete -c or -xa '(__fish_complete_subcommand)'
@@ -0,0 +1 @@
+complete -c pacmatic -w pacman
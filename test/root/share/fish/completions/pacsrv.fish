@@ -0,0 +1 @@
+complete -c pacsrc -w pacman
@@ -0,0 +1,4 @@
+
+__fish_complete_pgrep pgrep
+complete -c pgrep -s d -r -d 'Output delimiter'
+complete -c pgrep -s l    -d 'List the process name as well as the process ID'
@@ -0,0 +1 @@
+complete -c pon -d 'PPP connection' -xa '(__fish_complete_ppp_peer)'
@@ -0,0 +1,2 @@
+complete -c psub -s h -l help --description "Display help and exit"
+complete -c psub -s f -l file --description "Communicate using a regular file, not a named pipe"
@@ -0,0 +1,4 @@
+
+complete -c renice -s p --description "Force following parameters to be process ID's (The default)"
+complete -c renice -s g --description "Force following parameters to be interpreted as process group ID's"
+complete -c renice -s u --description "Force following parameters to be interpreted as user names"
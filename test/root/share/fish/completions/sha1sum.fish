@@ -0,0 +1 @@
+complete -c sha1sum -w md5sum
@@ -0,0 +1 @@
+complete -c sha224sum -w md5sum
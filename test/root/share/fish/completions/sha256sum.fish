@@ -0,0 +1 @@
+complete -c sha256sum -w md5sum
@@ -0,0 +1 @@
+complete -c sha384sum -w md5sum
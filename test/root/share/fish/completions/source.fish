@@ -0,0 +1 @@
+complete -c source -w .
@@ -0,0 +1,2 @@
+
+complete -xc whatis -a "(__fish_complete_man)"
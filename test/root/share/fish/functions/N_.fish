@@ -0,0 +1,6 @@
+
+
+function N_ --description "No-op"
+    printf "%s" $argv
+end
+
@@ -0,0 +1,4 @@
+function __fish_number_of_cmd_args_wo_opts
+    count (__fish_print_cmd_args_without_options)
+end
+
@@ -0,0 +1,5 @@
+# a function to print a list of ports local collections
+
+function __fish_ports_dirs -d 'Obtain a list of ports local collections'
+    ls /usr/ports
+end
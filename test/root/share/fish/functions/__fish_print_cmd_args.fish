@@ -0,0 +1,3 @@
+function __fish_print_cmd_args
+    commandline -poc
+end
@@ -0,0 +1,7 @@
+# check if command fish_indent works and is the same version that
+# came with this fish. This will happen one time.
+command -s fish_indent >/dev/null
+and command fish_indent --version 2>&1 | string match -rq $FISH_VERSION
+# if alias doesn't define the function here, this is an autoloaded "nothing".
+# the command (if there is one) will be used by default.
+or alias fish_indent=(string escape $__fish_bin_dir/fish_indent)
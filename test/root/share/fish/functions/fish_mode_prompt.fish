@@ -0,0 +1,5 @@
+# The fish_mode_prompt function is prepended to the prompt
+function fish_mode_prompt --description "Displays the current mode"
+    # To reuse the mode indicator use this function instead
+    fish_default_mode_prompt
+end
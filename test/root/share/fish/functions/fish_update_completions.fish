@@ -0,0 +1,4 @@
+function fish_update_completions --description "Update man-page based completions"
+    # Clean up old paths
+    python -B $__fish_datadir/tools/create_manpage_completions.py --manpath --progress --cleanup-in '~/.config/fish/completions' --cleanup-in '~/.config/fish/generated_completions'
+end
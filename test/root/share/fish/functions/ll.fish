@@ -0,0 +1,6 @@
+#
+# These are very common and useful
+#
+function ll --description "List contents of directory using long format"
+    ls -lh $argv
+end
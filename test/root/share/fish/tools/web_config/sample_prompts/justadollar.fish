@@ -0,0 +1,4 @@
+# name: Just a Dollar
+function fish_prompt
+    echo -n '$ '
+end